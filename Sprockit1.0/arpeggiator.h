@@ -1,27 +1,30 @@
-/*
- * arpeggiator.h
- *
- * Created: 1/02/2012 11:36:01 AM
- *  Author: Administrator
- */ 
-
-
-#ifndef ARPEGGIATOR_H_
-#define ARPEGGIATOR_H_
-
-#define ARPEGGIATOR_COUNTER_MAX		512
-
-void
-arpeggiator_reset_current_active_note(void);
-
-void
-arpeggiator_reset_timer(void);
-
-void
-arpeggiator(g_setting *p_global_setting);
-
-void
-initialize_arpeggiator(void);
-
-
+/*
+ * arpeggiator.h
+ *
+ * Created: 1/02/2012 11:36:01 AM
+ *  Author: Administrator
+ */ 
+
+
+#ifndef ARPEGGIATOR_H_
+#define ARPEGGIATOR_H_
+
+/*arpeggiator() is called once every slow tick (3200Hz). Each count of ARPEGGIATOR_SPEED is this many
+ticks of step length, so a speed of 127 is 127*2*5 = 1270 ticks, about 0.4s per step.*/
+#define ARPEGGIATOR_TICKS_PER_COUNT	5
+#define ARPEGGIATOR_COUNTER_MAX		(255*2*ARPEGGIATOR_TICKS_PER_COUNT)
+
+void
+arpeggiator_reset_current_active_note(void);
+
+void
+arpeggiator_reset_timer(void);
+
+void
+arpeggiator(g_setting *p_global_setting);
+
+void
+initialize_arpeggiator(void);
+
+
 #endif /* ARPEGGIATOR_H_ */
\ No newline at end of file
@@ -0,0 +1,810 @@
+/*
+@file audio_block.c
+
+@brief This module renders the audio output a block at a time into a ring buffer in SRAM.
+
+Working out every sample inside the timer 2 interrupt means paying for the interrupt prologue, two trips
+through the oscillator() call and reloading every parameter 32768 times a second. Here the main loop does the
+same oscillator, mix and low pass filter work for a whole block at once, with the parameters loaded one time
+per block. The timer 2 interrupt is left with nothing to do but copy the next byte from the ring into OCR1BL.
+If the ring ever runs dry, the interrupt holds the last output and counts an underrun.
+
+This file is part of Sprockit.
+
+    Sprockit is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Sprockit is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Sprockit.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#include <io.h>
+#include <pgmspace.h>
+#include <sprockit_main.h>
+#include <wavetables.h>
+#include <oscillator.h>
+#include <audio_block.h>
+#include <scheduler.h>
+#include <calculate_pitch.h>
+
+volatile unsigned char g_auc_audio_ring[AUDIO_RING_SIZE];
+volatile unsigned char g_uc_audio_ring_head;//Where the next rendered sample goes
+volatile unsigned char g_uc_audio_ring_tail;//The next sample the interrupt plays
+volatile unsigned char g_uc_audio_underrun_count;//Samples the interrupt found the ring empty for. Saturates at 255.
+unsigned int g_un_audio_block_max_cost;
+unsigned char g_uc_audio_block_over_budget_count;
+
+static OSCILLATOR_PLAN st_sub_plan;//The sub oscillator plays the SIN or SQUARE kernel for a note an octave or two down
+
+/*One unison voice. The increment comes first so the assembly kernel can walk through both with one pointer.*/
+typedef struct
+{
+	unsigned long ul_increment;
+	unsigned long ul_phase;
+} UNISON_VOICE;
+
+static UNISON_VOICE ast_unison_voice[UNISON_MAX_VOICES];
+
+/*Where each unison voice sits between the bottom and top of the spread, in 64ths, for 3, 4 and 5 voices*/
+const signed char ASC_UNISON_DETUNE_LUT[UNISON_MAX_VOICES - UNISON_MIN_VOICES + 1][UNISON_MAX_VOICES] PROGMEM =
+{
+	{-64,	0,		64,		0,		0},
+	{-64,	-21,	21,		64,		0},
+	{-64,	-32,	0,		32,		64},
+};
+
+/*256 / voices, so the sum of every voice at 255 still fits in 16 bits after the scaling*/
+const unsigned char AUC_UNISON_GAIN_LUT[UNISON_MAX_VOICES - UNISON_MIN_VOICES + 1] PROGMEM = {85, 64, 51};
+
+#if ASM_KERNELS && ASM_KERNEL_CHECK
+unsigned char g_auc_unison_cycles[UNISON_MAX_VOICES][2];
+#endif
+
+/*
+@brief This function mixes the two oscillator samples and the sub oscillator and runs the mix through the one pole
+low pass filter. The sub oscillator is centered on 0 and added on top of the oscillator mix, clipping at 0 and 255,
+so with its level at 0 the oscillator mix is exactly what it was.
+
+@param It takes the two oscillator samples, their levels, the sub oscillator sample, its level and the last output sample.
+
+@return It returns the new output sample.
+*/
+#if !ASM_KERNELS || ASM_KERNEL_CHECK
+static inline unsigned char
+audio_block_mix_filter(unsigned char uc_osc_1, unsigned char uc_osc_2, unsigned char uc_osc_1_level, unsigned char uc_osc_2_level,
+						unsigned char uc_sub, unsigned char uc_sub_level, unsigned char uc_last_sample)
+{
+	unsigned int un_temp1;
+	signed int sn_low_pass_filter_calc;
+	
+	//mix the oscillators, by scaling each and adding them together
+	un_temp1 = uc_osc_1*uc_osc_1_level;
+	un_temp1 += uc_osc_2*uc_osc_2_level;
+	sn_low_pass_filter_calc = un_temp1>>8;
+	
+	//add the sub oscillator
+	sn_low_pass_filter_calc += ((signed char)(uc_sub ^ 0x80) * uc_sub_level) >> 8;
+	
+	if(sn_low_pass_filter_calc > 255)
+	{
+		sn_low_pass_filter_calc = 255;
+	}
+	else if(sn_low_pass_filter_calc < 0)
+	{
+		sn_low_pass_filter_calc = 0;
+	}
+	
+	uc_osc_1 = sn_low_pass_filter_calc;
+
+	//low pass filter
+	sn_low_pass_filter_calc = uc_osc_1 - uc_last_sample;
+	sn_low_pass_filter_calc >>= 2;
+	sn_low_pass_filter_calc += uc_last_sample;
+	
+	return sn_low_pass_filter_calc;
+}
+#endif
+
+#if ASM_KERNELS
+/*The same in assembly, 21 to 23 cycles. The mix is the top byte of the two MULs added together. The sub oscillator
+is the top byte of a signed MULSU, added with the carry telling when it went past 255 or 0. The filter's difference
+is 9 bits with the borrow as its sign, so ror brings the borrow back in as the sign bit for the first divide by 2
+and asr does the second.*/
+static inline unsigned char
+audio_block_mix_filter_asm(unsigned char uc_osc_1, unsigned char uc_osc_2, unsigned char uc_osc_1_level, unsigned char uc_osc_2_level,
+							unsigned char uc_sub, unsigned char uc_sub_level, unsigned char uc_last_sample)
+{
+	unsigned int un_temp1;
+	unsigned char uc_sub_centered;
+	
+	__asm__ (
+		"mul %[osc_1], %[osc_1_level]"			"\n\t"	//osc 1 * level 1 + osc 2 * level 2
+		"movw %[temp], r0"						"\n\t"
+		"mul %[osc_2], %[osc_2_level]"			"\n\t"
+		"add %A[temp], r0"						"\n\t"
+		"adc %B[temp], r1"						"\n\t"
+		"mov %[centered], %[sub]"				"\n\t"	//(sub - 128) * sub level
+		"subi %[centered], 0x80"				"\n\t"
+		"mulsu %[centered], %[sub_level]"		"\n\t"
+		"tst r1"								"\n\t"
+		"brmi 1f"								"\n\t"
+		"add %B[temp], r1"						"\n\t"	//pushing the mix up, stop at 255
+		"brcc 2f"								"\n\t"
+		"ldi %B[temp], 255"						"\n\t"
+		"rjmp 2f"								"\n\t"
+	"1:	add %B[temp], r1"						"\n\t"	//pulling it down, stop at 0
+		"brcs 2f"								"\n\t"
+		"ldi %B[temp], 0"						"\n\t"
+	"2:	clr __zero_reg__"						"\n\t"
+		"sub %B[temp], %[last]"					"\n\t"	//mix - last sample
+		"ror %B[temp]"							"\n\t"	//divide by 4, keeping the sign
+		"asr %B[temp]"							"\n\t"
+		"add %[last], %B[temp]"					"\n\t"	//+ last sample
+		: [last] "+r" (uc_last_sample),
+		  [temp] "=&d" (un_temp1),
+		  [centered] "=&a" (uc_sub_centered)
+		: [osc_1] "r" (uc_osc_1),
+		  [osc_2] "r" (uc_osc_2),
+		  [osc_1_level] "r" (uc_osc_1_level),
+		  [osc_2_level] "r" (uc_osc_2_level),
+		  [sub] "r" (uc_sub),
+		  [sub_level] "a" (uc_sub_level)
+	);
+	
+	return uc_last_sample;
+}
+
+#define AUDIO_BLOCK_MIX_FILTER	audio_block_mix_filter_asm
+#else
+#define AUDIO_BLOCK_MIX_FILTER	audio_block_mix_filter
+#endif
+
+/*
+@brief This function is the phase modulation. OSC_1's sample, centered on 0, times the amount is added to OSC_2's phase.
+
+@param It takes OSC_2's phase, OSC_1's sample and the amount.
+
+@return It returns OSC_2's modulated phase.
+*/
+#if !ASM_KERNELS || ASM_KERNEL_CHECK
+static inline unsigned int
+audio_block_phase_mod(unsigned int un_phase, unsigned char uc_sample, unsigned char uc_amount)
+{
+	return un_phase + (signed char)(uc_sample ^ 0x80) * uc_amount;
+}
+#endif
+
+#if ASM_KERNELS
+/*The same in assembly, 6 cycles every time. MULSU takes the centered sample as signed and the amount as unsigned,
+and the product is added straight onto the phase.*/
+static inline unsigned int
+audio_block_phase_mod_asm(unsigned int un_phase, unsigned char uc_sample, unsigned char uc_amount)
+{
+	__asm__ (
+		"subi %[sample], 0x80"					"\n\t"	//sample - 128
+		"mulsu %[sample], %[amount]"			"\n\t"
+		"add %A[phase], r0"						"\n\t"	//phase + product
+		"adc %B[phase], r1"						"\n\t"
+		"clr __zero_reg__"						"\n\t"
+		: [phase] "+r" (un_phase),
+		  [sample] "+a" (uc_sample)
+		: [amount] "a" (uc_amount)
+	);
+	
+	return un_phase;
+}
+
+#define AUDIO_BLOCK_PHASE_MOD	audio_block_phase_mod_asm
+#else
+#define AUDIO_BLOCK_PHASE_MOD	audio_block_phase_mod
+#endif
+
+/*
+@brief This function is the unison inner loop. Every voice adds its increment to its phase, reads the one ramp row,
+stored as a half cycle, at the top byte of the phase and adds the sample to the sum. The sum is scaled back down to 8 bits by the gain.
+
+@param It takes the voices, how many there are (at least 1), the wavetable row in program memory and the gain.
+
+@return It returns the sample.
+*/
+#if !ASM_KERNELS || ASM_KERNEL_CHECK
+static inline unsigned char
+audio_block_unison(UNISON_VOICE *p_voice, unsigned char uc_voices, const unsigned char *p_uc_row, unsigned char uc_gain)
+{
+	unsigned int un_sum = 0;
+	
+	do
+	{
+		p_voice->ul_phase += p_voice->ul_increment;
+		un_sum += wavetable_half(p_uc_row, p_voice->ul_phase >> 16);
+		p_voice++;
+		
+	}while(--uc_voices);
+	
+	return (un_sum * uc_gain) >> 8;
+}
+#endif
+
+#if ASM_KERNELS
+/*The same in assembly, 42 cycles a voice and 8 more for the scaling. LD and ST leave the carry alone, so each byte of
+the phase is loaded, added to and stored before the next one. Only the bottom 3 bytes of the phase and increment
+are used; the phase wraps at 24 bits anyway and its top byte is never read. The row is read as wavetable_half()
+does it, at entry (top byte + 1) negated in the second half, where the sample is turned over. The scaling is the sum times the gain,
+high byte times gain plus the top of low byte times gain, which can't carry because the sum was kept in range.*/
+static inline unsigned char
+audio_block_unison_asm(UNISON_VOICE *p_voice, unsigned char uc_voices, const unsigned char *p_uc_row, unsigned char uc_gain)
+{
+	unsigned int	un_sum,
+					un_address;
+	unsigned char	uc_increment_0,
+					uc_increment_1,
+					uc_increment_2,
+					uc_temp,
+					uc_index;
+	
+	__asm__ volatile (
+		"clr %A[sum]"							"\n\t"
+		"clr %B[sum]"							"\n\t"
+	"1:	ld %[increment_0], %a[voice]+"		"\n\t"	//the bottom 3 bytes of the increment
+		"ld %[increment_1], %a[voice]+"			"\n\t"
+		"ld %[increment_2], %a[voice]+"			"\n\t"
+		"adiw %[voice], 1"						"\n\t"
+		"ld %[temp], %a[voice]"					"\n\t"	//phase += increment, a byte at a time
+		"add %[temp], %[increment_0]"			"\n\t"
+		"st %a[voice]+, %[temp]"				"\n\t"
+		"ld %[temp], %a[voice]"					"\n\t"
+		"adc %[temp], %[increment_1]"			"\n\t"
+		"st %a[voice]+, %[temp]"				"\n\t"
+		"ld %[temp], %a[voice]"					"\n\t"
+		"adc %[temp], %[increment_2]"			"\n\t"
+		"st %a[voice]+, %[temp]"				"\n\t"
+		"adiw %[voice], 1"						"\n\t"	//on to the next voice
+		"mov %[index], %[temp]"					"\n\t"	//sum += wavetable_half(row, top byte of the phase)
+		"subi %[index], -1"						"\n\t"
+		"sbrc %[temp], 7"						"\n\t"
+		"neg %[index]"							"\n\t"
+		"movw %[address], %[row]"				"\n\t"
+		"add %A[address], %[index]"				"\n\t"
+		"adc %B[address], __zero_reg__"			"\n\t"
+		"lpm %[index], %a[address]"				"\n\t"
+		"sbrc %[temp], 7"						"\n\t"
+		"com %[index]"							"\n\t"
+		"add %A[sum], %[index]"					"\n\t"
+		"adc %B[sum], __zero_reg__"				"\n\t"
+		"dec %[voices]"							"\n\t"
+		"brne 1b"								"\n\t"
+		"mul %A[sum], %[gain]"					"\n\t"	//(sum * gain) >> 8
+		"mov %[temp], r1"						"\n\t"
+		"mul %B[sum], %[gain]"					"\n\t"
+		"add %[temp], r0"						"\n\t"
+		"clr __zero_reg__"						"\n\t"
+		: [voice] "+x" (p_voice),
+		  [voices] "+r" (uc_voices),
+		  [sum] "=&r" (un_sum),
+		  [address] "=&z" (un_address),
+		  [increment_0] "=&r" (uc_increment_0),
+		  [increment_1] "=&r" (uc_increment_1),
+		  [increment_2] "=&r" (uc_increment_2),
+		  [temp] "=&r" (uc_temp),
+		  [index] "=&d" (uc_index)
+		: [row] "r" (p_uc_row),
+		  [gain] "r" (uc_gain)
+		: "memory"
+	);
+	
+	return uc_temp;
+}
+
+#define AUDIO_BLOCK_UNISON	audio_block_unison_asm
+#else
+#define AUDIO_BLOCK_UNISON	audio_block_unison
+#endif
+
+/*
+@brief This function spreads the unison voices' increments around OSC_1's increment. The spread is a fraction of the
+step from OSC_1's note to the next one up in the phase increment table, so it is the same number of cents at every
+note. It only does the work when something has changed.
+
+@param It takes OSC_1's increment and note, the spread and how many voices there are.
+
+@return It doesn't return anything.
+*/
+static void
+audio_block_unison_tune(unsigned long ul_increment, unsigned char uc_note, unsigned char uc_spread, unsigned char uc_voices)
+{
+	static unsigned long ul_last_increment;
+	static unsigned char uc_last_note,
+						 uc_last_spread,
+						 uc_last_voices;
+
+	const signed char *p_sc_detune;
+	unsigned long ul_detune;
+	unsigned char uc_voice;
+	
+	if(ul_increment == ul_last_increment && uc_note == uc_last_note && uc_spread == uc_last_spread && uc_voices == uc_last_voices)
+	{
+		return;
+	}
+	
+	ul_last_increment = ul_increment;
+	uc_last_note = uc_note;
+	uc_last_spread = uc_spread;
+	uc_last_voices = uc_voices;
+	
+	if(uc_note > 126)
+	{
+		uc_note = 126;
+	}
+	
+	//the outer voices are this far either side of OSC_1
+	ul_detune = pgm_read_dword(&AUL_PHASE_INCREMENT_LUT[uc_note + 1]) - pgm_read_dword(&AUL_PHASE_INCREMENT_LUT[uc_note]);
+	ul_detune = (ul_detune * uc_spread) >> 8;
+	
+	p_sc_detune = ASC_UNISON_DETUNE_LUT[uc_voices - UNISON_MIN_VOICES];
+	
+	for(uc_voice = 0; uc_voice < uc_voices; uc_voice++)
+	{
+		ast_unison_voice[uc_voice].ul_increment = ul_increment + (((signed long)ul_detune * (signed char)pgm_read_byte(&p_sc_detune[uc_voice])) >> 6);
+	}
+}
+
+/*
+@brief This function fills the output ring before the main loop starts and clears the underrun count,
+so the samples missed while the rest of the system was starting up don't show up as underruns.
+
+@param It takes the global setting structure.
+
+@return It doesn't return anything.
+*/
+void
+audio_block_init(g_setting *p_global_setting)
+{
+	unsigned char uc_voice;
+	
+	st_sub_plan.uc_waveshape = OSCILLATOR_PLAN_STALE;
+	
+	//The unison voices run free. Start them spread around the cycle so they don't all line up on the first edge.
+	for(uc_voice = 0; uc_voice < UNISON_MAX_VOICES; uc_voice++)
+	{
+		ast_unison_voice[uc_voice].ul_phase = uc_voice * 0x00333333UL;
+	}
+	
+	while(audio_block_render(p_global_setting));
+
+	g_uc_audio_underrun_count = 0;
+}
+
+/*
+@brief This function renders one block of samples into the output ring, if there is room for a whole block.
+
+@param It takes the global setting structure.
+
+@return It returns TRUE if it rendered a block, FALSE if the ring was too full.
+
+The work per sample is the same as the timer 2 interrupt used to do: two oscillators, the phase modulation,
+the sub oscillator, the mix, the one pole low pass filter and the hard sync. With unison on, OSC_1's kernel call
+is swapped for the unison loop, which costs 42 cycles a voice and 8 more in assembly, so 5 voices take about 218 of
+the 600 cycle sample budget where the half kernel took about 30. The mix and frequencies are read
+once at the start of the block, and each oscillator's render plan (see oscillator_plan_update()) has already
+picked its kernel, wavetable rows and blend weights.
+*/
+unsigned char
+audio_block_render(g_setting *p_global_setting)
+{
+	static unsigned char uc_last_sample = 127;
+
+	unsigned char	uc_head,
+					uc_count,
+					uc_osc_1_level,
+					uc_osc_2_level,
+					uc_sync,
+					uc_pm_amount,
+					uc_sub_level,
+					uc_sub_mode,
+					uc_sub_count,
+					uc_sub,
+					uc_unison_voices,
+					uc_unison_gain,
+					uc_start_ticks,
+					uc_start,
+					uc_end_ticks,
+					uc_end,
+					uc_temp1,
+					uc_temp2;
+
+	unsigned int	un_osc_2_phase,
+					un_sub_phase,
+					un_cost;
+
+	unsigned long	ul_osc_1_reference,
+					ul_osc_2_reference,
+					ul_osc_1_increment,
+					ul_osc_2_increment;
+
+	OSCILLATOR_PLAN *p_osc_1_plan = &g_ast_oscillator_plan[OSC_1],
+					*p_osc_2_plan = &g_ast_oscillator_plan[OSC_2];
+	
+	OSCILLATOR_STATE *p_osc_1_state = &g_ast_oscillator_state[OSC_1],
+					 *p_osc_2_state = &g_ast_oscillator_state[OSC_2];
+	
+	const unsigned char *p_uc_unison_row;
+
+	uc_head = g_uc_audio_ring_head;
+
+	/*Is there room for a whole block? One slot always stays empty.*/
+	if(((g_uc_audio_ring_tail - uc_head - 1) & AUDIO_RING_MASK) < AUDIO_BLOCK_SIZE)
+	{
+		return FALSE;
+	}
+
+	if(1 == g_uc_note_on_flag)
+	{
+		SCHEDULER_TIMER0_READ(uc_start_ticks, uc_start);
+		
+		/*Bring the render plans up to date. They only get rebuilt if the waveshape, note or morph rate changed.*/
+		oscillator_plan_update(p_osc_1_plan, p_global_setting->auc_synth_params[OSC_1_WAVESHAPE], p_global_setting->auc_table_note[OSC_1], p_global_setting->auc_synth_params[MORPH_RATE]);
+		oscillator_plan_update(p_osc_2_plan, p_global_setting->auc_synth_params[OSC_2_WAVESHAPE], p_global_setting->auc_table_note[OSC_2], p_global_setting->auc_synth_params[MORPH_RATE]);
+		
+		/*The scanning waveshape's frames and crossfade follow its position, which the LFO and envelope move.*/
+		if(WAVETABLE_SCAN == p_osc_1_plan->uc_waveshape || WAVETABLE_SCAN == p_osc_2_plan->uc_waveshape)
+		{
+			uc_temp1 = oscillator_scan_position(p_global_setting);
+			
+			if(WAVETABLE_SCAN == p_osc_1_plan->uc_waveshape)
+			{
+				oscillator_plan_scan(p_osc_1_plan, uc_temp1);
+			}
+			
+			if(WAVETABLE_SCAN == p_osc_2_plan->uc_waveshape)
+			{
+				oscillator_plan_scan(p_osc_2_plan, uc_temp1);
+			}
+		}
+		
+		uc_osc_2_level = p_global_setting->auc_synth_params[OSC_MIX];
+		uc_osc_1_level = 255 - uc_osc_2_level;
+		uc_sync = (p_global_setting->auc_synth_params[OSC_SYNC] >= OSC_SYNC_ON);
+		uc_pm_amount = p_global_setting->auc_synth_params[PM_AMOUNT];
+		ul_osc_1_increment = p_global_setting->aul_phase_increment[OSC_1];
+		ul_osc_2_increment = p_global_setting->aul_phase_increment[OSC_2];
+		ul_osc_1_reference = p_global_setting->aul_sample_reference[OSC_1];
+		ul_osc_2_reference = p_global_setting->aul_sample_reference[OSC_2];
+		
+		/*The sub oscillator plays OSC_1's note an octave or two down, on the sin or square kernel.*/
+		uc_sub_level = p_global_setting->auc_synth_params[SUB_LEVEL];
+		uc_sub_mode = p_global_setting->auc_synth_params[SUB_MODE];
+		uc_sub_count = p_global_setting->aul_sample_reference[OSC_SUB];
+		uc_sub = 128;
+		uc_temp2 = (uc_sub_mode & SUB_MODE_TWO_OCTAVES) ? 24 : 12;
+		uc_temp1 = p_global_setting->auc_table_note[OSC_1];
+		uc_temp1 = (uc_temp1 > uc_temp2) ? uc_temp1 - uc_temp2 : 0;
+		oscillator_plan_update(&st_sub_plan, (uc_sub_mode & SUB_MODE_SIN) ? SIN : SQUARE, uc_temp1, 0);
+		
+		/*Unison. OSC_1 is replaced by 3 to 5 ramps detuned around its increment, all reading the one ramp row. The row
+		is for the top voice, a semitone above OSC_1 once the spread is past halfway, so that voice doesn't alias.
+		Its own phase still runs, so the sub oscillator and hard sync follow it as before.*/
+		uc_unison_voices = p_global_setting->auc_synth_params[UNISON_VOICES] >> 6;
+		uc_unison_gain = 0;
+		p_uc_unison_row = 0;
+		
+		if(uc_unison_voices != 0)
+		{
+			uc_unison_voices += UNISON_MIN_VOICES - 1;
+			uc_unison_gain = pgm_read_byte(&AUC_UNISON_GAIN_LUT[uc_unison_voices - UNISON_MIN_VOICES]);
+			uc_temp1 = p_global_setting->auc_table_note[OSC_1];
+			uc_temp2 = p_global_setting->auc_synth_params[UNISON_SPREAD];
+			audio_block_unison_tune(ul_osc_1_increment, uc_temp1, uc_temp2, uc_unison_voices);
+			
+			uc_temp1 += uc_temp2 >> 7;
+			p_uc_unison_row = &G_AUC_RAMP_WAVETABLE_LUT[(uc_temp1 > 127 ? 127 : uc_temp1) >> 2][0];
+		}
+
+		//A new note starts every oscillator's morph over.
+		if(g_uc_oscillator_midi_sync_flag == 1)
+		{
+			g_uc_oscillator_midi_sync_flag = 0;
+			oscillator_sync(p_osc_1_state, p_osc_1_plan->uc_waveshape);
+			oscillator_sync(p_osc_2_state, p_osc_2_plan->uc_waveshape);
+		}
+
+		for(uc_count = 0; uc_count < AUDIO_BLOCK_SIZE; uc_count++)
+		{
+			//The kernels get the 16 bit phase. It wraps around by itself, no checking needed.
+			if(uc_unison_voices != 0)
+			{
+				uc_temp1 = AUDIO_BLOCK_UNISON(ast_unison_voice, uc_unison_voices, p_uc_unison_row, uc_unison_gain);
+			}
+			else
+			{
+				uc_temp1 = p_osc_1_plan->pf_kernel(p_osc_1_plan, p_osc_1_state, (unsigned int)(ul_osc_1_reference >> 8));
+			}
+			
+			/*Phase modulation. OSC_1's sample, centered on 0, times the amount is added to OSC_2's phase before
+			it looks up its table. One multiply-add, and nothing at all changes with the amount at 0.*/
+			un_osc_2_phase = AUDIO_BLOCK_PHASE_MOD(ul_osc_2_reference >> 8, uc_temp1, uc_pm_amount);
+			
+			uc_temp2 = p_osc_2_plan->pf_kernel(p_osc_2_plan, p_osc_2_state, un_osc_2_phase);
+			
+			/*The sub oscillator's phase is OSC_1's phase shifted down an octave or two, with the bottom bits of
+			OSC_1's cycle count shifted in on top. A shift and a table kernel rather than a whole oscillator.*/
+			if(uc_sub_level != 0)
+			{
+				un_sub_phase = ul_osc_1_reference >> 8;
+				
+				if(uc_sub_mode & SUB_MODE_TWO_OCTAVES)
+				{
+					un_sub_phase = ((unsigned int)uc_sub_count << 14) | (un_sub_phase >> 2);
+				}
+				else
+				{
+					un_sub_phase = ((unsigned int)uc_sub_count << 15) | (un_sub_phase >> 1);
+				}
+				
+				uc_sub = st_sub_plan.pf_kernel(&st_sub_plan, p_osc_1_state, un_sub_phase);
+			}
+
+			//mix the oscillators and the sub oscillator and low pass filter the mix
+			uc_last_sample = AUDIO_BLOCK_MIX_FILTER(uc_temp1, uc_temp2, uc_osc_1_level, uc_osc_2_level, uc_sub, uc_sub_level, uc_last_sample);
+
+			g_auc_audio_ring[uc_head] = uc_last_sample;
+			uc_head = (uc_head + 1) & AUDIO_RING_MASK;
+
+			ul_osc_1_reference += ul_osc_1_increment;
+			ul_osc_2_reference += ul_osc_2_increment;
+			
+			/*Hard sync. When OSC_1 goes past the end of its cycle, OSC_2 starts its cycle over. OSC_2 still plays
+			the band limited table for its own note, so the only new edge is the reset.*/
+			if(ul_osc_1_reference & SAMPLE_REFERENCE_WRAP)
+			{
+				ul_osc_1_reference &= SAMPLE_REFERENCE_MASK;
+				uc_sub_count++;
+				
+				if(uc_sync)
+				{
+					ul_osc_2_reference = 0;
+				}
+			}
+		}
+
+		p_global_setting->aul_sample_reference[OSC_1] = ul_osc_1_reference;
+		p_global_setting->aul_sample_reference[OSC_2] = ul_osc_2_reference;
+		p_global_setting->aul_sample_reference[OSC_SUB] = uc_sub_count;
+		
+		//How long did that take? TIMER0 goes round every slow tick, so the ticks that went by are counted in as well.
+		SCHEDULER_TIMER0_READ(uc_end_ticks, uc_end);
+		un_cost = (unsigned char)(uc_end_ticks - uc_start_ticks) * SCHEDULER_TICK_COUNTS + uc_end - uc_start;
+		
+		if(un_cost > g_un_audio_block_max_cost)
+		{
+			g_un_audio_block_max_cost = un_cost;
+		}
+		
+		if(un_cost > AUDIO_BLOCK_BUDGET && g_uc_audio_block_over_budget_count < 0xFF)
+		{
+			g_uc_audio_block_over_budget_count++;
+		}
+	}
+	else
+	{
+		for(uc_count = 0; uc_count < AUDIO_BLOCK_SIZE; uc_count++)
+		{
+			g_auc_audio_ring[uc_head] = 0;
+			uc_head = (uc_head + 1) & AUDIO_RING_MASK;
+		}
+
+		p_global_setting->aul_sample_reference[OSC_1] = 0;
+		p_global_setting->aul_sample_reference[OSC_2] = 0;
+		p_global_setting->aul_sample_reference[OSC_SUB] = 0;
+	}
+
+	/*Publish the block. The head is one byte, so the interrupt always sees all of it or none of it.*/
+	g_uc_audio_ring_head = uc_head;
+
+	return TRUE;
+}
+
+#if ASM_KERNELS && ASM_KERNEL_CHECK
+/*
+@brief This function runs the assembly mix and filter against the C version over every mix level and last sample,
+with a spread of oscillator and sub oscillator samples and sub levels, and keeps the worst case cycles of each. The results end up in
+g_un_asm_kernel_mismatch_count and g_auc_asm_kernel_cycles. It takes a few seconds and has to run with interrupts off.
+
+@param It takes no parameters.
+
+@return It doesn't return anything.
+*/
+void
+audio_block_mix_filter_check(void)
+{
+	/*Called through pointers so that both are timed the same way, with a call around them*/
+	unsigned char (*pf_reference)(unsigned char, unsigned char, unsigned char, unsigned char, unsigned char, unsigned char, unsigned char) = audio_block_mix_filter;
+	unsigned char (*pf_asm)(unsigned char, unsigned char, unsigned char, unsigned char, unsigned char, unsigned char, unsigned char) = audio_block_mix_filter_asm;
+	
+	unsigned char	uc_osc_1 = 0,
+					uc_osc_2 = 0,
+					uc_level = 0,
+					uc_last_sample = 0,
+					uc_reference,
+					uc_result,
+					uc_cycles;
+					
+	do
+	{
+		do
+		{
+			do
+			{
+				ASM_KERNEL_CYCLES(uc_cycles, uc_reference = pf_reference(uc_osc_1, uc_osc_2, 255 - uc_level, uc_level, uc_last_sample ^ uc_osc_2, uc_level + uc_osc_1, uc_last_sample));
+				
+				if(uc_cycles > g_auc_asm_kernel_cycles[ASM_KERNEL_MIX_FILTER][0])
+				{
+					g_auc_asm_kernel_cycles[ASM_KERNEL_MIX_FILTER][0] = uc_cycles;
+				}
+				
+				ASM_KERNEL_CYCLES(uc_cycles, uc_result = pf_asm(uc_osc_1, uc_osc_2, 255 - uc_level, uc_level, uc_last_sample ^ uc_osc_2, uc_level + uc_osc_1, uc_last_sample));
+				
+				if(uc_cycles > g_auc_asm_kernel_cycles[ASM_KERNEL_MIX_FILTER][1])
+				{
+					g_auc_asm_kernel_cycles[ASM_KERNEL_MIX_FILTER][1] = uc_cycles;
+				}
+				
+				if(uc_result != uc_reference)
+				{
+					g_un_asm_kernel_mismatch_count++;
+				}
+				
+				uc_last_sample++;
+				
+			}while(uc_last_sample != 0);
+			
+			uc_level++;
+			
+		}while(uc_level != 0);
+		
+		//19 pairs of oscillator samples, with every level and last sample for each
+		uc_osc_1 += 13;
+		uc_osc_2 += 29;
+		
+	}while(uc_osc_1 < 247);
+}
+
+/*
+@brief This function runs the assembly phase modulation against the C version over every sample and amount, and
+keeps the worst case cycles of each. The results end up in g_un_asm_kernel_mismatch_count and
+g_auc_asm_kernel_cycles. It has to run with interrupts off.
+
+@param It takes no parameters.
+
+@return It doesn't return anything.
+*/
+void
+audio_block_phase_mod_check(void)
+{
+	/*Called through pointers so that both are timed the same way, with a call around them*/
+	unsigned int (*pf_reference)(unsigned int, unsigned char, unsigned char) = audio_block_phase_mod;
+	unsigned int (*pf_asm)(unsigned int, unsigned char, unsigned char) = audio_block_phase_mod_asm;
+	
+	unsigned char	uc_sample = 0,
+					uc_amount = 0,
+					uc_cycles;
+	
+	unsigned int	un_phase = 0,
+					un_reference,
+					un_result;
+	
+	do
+	{
+		do
+		{
+			ASM_KERNEL_CYCLES(uc_cycles, un_reference = pf_reference(un_phase, uc_sample, uc_amount));
+			
+			if(uc_cycles > g_auc_asm_kernel_cycles[ASM_KERNEL_PHASE_MOD][0])
+			{
+				g_auc_asm_kernel_cycles[ASM_KERNEL_PHASE_MOD][0] = uc_cycles;
+			}
+			
+			ASM_KERNEL_CYCLES(uc_cycles, un_result = pf_asm(un_phase, uc_sample, uc_amount));
+			
+			if(uc_cycles > g_auc_asm_kernel_cycles[ASM_KERNEL_PHASE_MOD][1])
+			{
+				g_auc_asm_kernel_cycles[ASM_KERNEL_PHASE_MOD][1] = uc_cycles;
+			}
+			
+			if(un_result != un_reference)
+			{
+				g_un_asm_kernel_mismatch_count++;
+			}
+			
+			//walk the phase around too, so the add carries out of the top byte and borrows from it
+			un_phase += 0x0405;
+			uc_amount++;
+			
+		}while(uc_amount != 0);
+		
+		uc_sample++;
+		
+	}while(uc_sample != 0);
+}
+
+/*
+@brief This function runs the assembly unison loop against the C version with 1 to UNISON_MAX_VOICES voices, on every
+eighth note, and keeps the worst case cycles for each voice count in g_auc_unison_cycles. The step from one voice
+count to the next is the cost of one more voice. The C version with 5 voices can go past 255 cycles, where timer 1
+wraps, so its last count is only good if it is bigger than the one before it. Mismatches go in
+g_un_asm_kernel_mismatch_count and the worst case with every voice goes in g_auc_asm_kernel_cycles. It has to
+run with interrupts off.
+
+@param It takes no parameters.
+
+@return It doesn't return anything.
+*/
+void
+audio_block_unison_check(void)
+{
+	/*Called through pointers so that both are timed the same way, with a call around them*/
+	unsigned char (*pf_reference)(UNISON_VOICE *, unsigned char, const unsigned char *, unsigned char) = audio_block_unison;
+	unsigned char (*pf_asm)(UNISON_VOICE *, unsigned char, const unsigned char *, unsigned char) = audio_block_unison_asm;
+	
+	UNISON_VOICE	ast_reference_voice[UNISON_MAX_VOICES],
+					ast_asm_voice[UNISON_MAX_VOICES];
+	
+	const unsigned char *p_uc_row;
+	
+	unsigned char	uc_voices,
+					uc_voice,
+					uc_note,
+					uc_reference,
+					uc_result,
+					uc_cycles;
+	
+	unsigned int un_count;
+	
+	for(uc_voices = 1; uc_voices <= UNISON_MAX_VOICES; uc_voices++)
+	{
+		for(uc_note = 0; uc_note < 128; uc_note += 8)
+		{
+			p_uc_row = &G_AUC_RAMP_WAVETABLE_LUT[uc_note >> 2][0];
+			
+			//the voices a little apart in pitch and phase, the same for both
+			for(uc_voice = 0; uc_voice < uc_voices; uc_voice++)
+			{
+				ast_reference_voice[uc_voice].ul_increment = pgm_read_dword(&AUL_PHASE_INCREMENT_LUT[uc_note]) + ((unsigned long)uc_voice << 9);
+				ast_reference_voice[uc_voice].ul_phase = uc_voice * 0x00333333UL;
+				ast_asm_voice[uc_voice] = ast_reference_voice[uc_voice];
+			}
+			
+			for(un_count = 0; un_count < 1024; un_count++)
+			{
+				ASM_KERNEL_CYCLES(uc_cycles, uc_reference = pf_reference(ast_reference_voice, uc_voices, p_uc_row, 256 / UNISON_MAX_VOICES));
+				
+				if(uc_cycles > g_auc_unison_cycles[uc_voices - 1][0])
+				{
+					g_auc_unison_cycles[uc_voices - 1][0] = uc_cycles;
+				}
+				
+				ASM_KERNEL_CYCLES(uc_cycles, uc_result = pf_asm(ast_asm_voice, uc_voices, p_uc_row, 256 / UNISON_MAX_VOICES));
+				
+				if(uc_cycles > g_auc_unison_cycles[uc_voices - 1][1])
+				{
+					g_auc_unison_cycles[uc_voices - 1][1] = uc_cycles;
+				}
+				
+				if(uc_result != uc_reference)
+				{
+					g_un_asm_kernel_mismatch_count++;
+				}
+			}
+		}
+	}
+	
+	g_auc_asm_kernel_cycles[ASM_KERNEL_UNISON][0] = g_auc_unison_cycles[UNISON_MAX_VOICES - 1][0];
+	g_auc_asm_kernel_cycles[ASM_KERNEL_UNISON][1] = g_auc_unison_cycles[UNISON_MAX_VOICES - 1][1];
+}
+#endif
@@ -0,0 +1,70 @@
+/*
+	This file is part of Sprockit.
+
+    Sprockit is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Sprockit is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Sprockit.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef AUDIO_BLOCK_H
+#define AUDIO_BLOCK_H
+
+#define AUDIO_BLOCK_RENDERING	1	//1 = the main loop renders blocks into the output ring and the timer 2 interrupt only plays them out.
+									//0 = every sample is worked out inside the timer 2 interrupt, the old way.
+#define AUDIO_BLOCK_SIZE		16	//Samples rendered at a time, about half a millisecond
+#define AUDIO_RING_SIZE			64	//Must be a power of 2, no more than 256. 64 samples is about 2ms of latency.
+#define AUDIO_RING_MASK			(AUDIO_RING_SIZE - 1)
+
+//Output ring. The main loop renders at the head, the timer 2 interrupt plays from the tail.
+//One slot is always left empty so head == tail means empty.
+extern volatile unsigned char g_auc_audio_ring[AUDIO_RING_SIZE];
+extern volatile unsigned char g_uc_audio_ring_head;
+extern volatile unsigned char g_uc_audio_ring_tail;
+extern volatile unsigned char g_uc_audio_underrun_count;
+
+//Longest a block has been seen to take to render, in TIMER0 counts of 64 cycles, with the interrupts that landed on it.
+//The slow ticks are counted too, so it's good for blocks of up to 255 ticks. The sample budget is 600 cycles, so a block
+//has to stay under AUDIO_BLOCK_BUDGET, less the time the slow tick tasks need.
+extern unsigned int g_un_audio_block_max_cost;
+extern unsigned char g_uc_audio_block_over_budget_count;//Blocks that took longer than AUDIO_BLOCK_BUDGET. Saturates at 255.
+
+#define AUDIO_BLOCK_BUDGET		(AUDIO_BLOCK_SIZE * 600 / 64)
+
+//Unison. With UNISON_VOICES turned up, OSC_1 is a stack of detuned ramps all reading the same wavetable row.
+#define UNISON_MIN_VOICES		3
+#define UNISON_MAX_VOICES		5
+
+#if ASM_KERNELS && ASM_KERNEL_CHECK
+//Worst case cycles for the unison kernel with 1 to UNISON_MAX_VOICES voices, C then assembly. The step from one
+//voice count to the next is the cost of a voice.
+extern unsigned char g_auc_unison_cycles[UNISON_MAX_VOICES][2];
+#endif
+
+//Function prototypes
+void
+audio_block_init(g_setting *p_global_setting);
+
+unsigned char
+audio_block_render(g_setting *p_global_setting);
+
+#if ASM_KERNELS && ASM_KERNEL_CHECK
+void
+audio_block_mix_filter_check(void);
+
+void
+audio_block_phase_mod_check(void);
+
+void
+audio_block_unison_check(void);
+#endif
+
+#endif /*AUDIO_BLOCK_H*/
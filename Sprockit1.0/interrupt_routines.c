@@ -1,213 +1,372 @@
-/*
-@file interrupt_routines.c
-
-@brief This module contains the interrupt routines.  These routines
-handles things like timer interrupts, switch press interrupts, 
-and spi transmission complete interrupts.
-
-
-@ Created by Matt Heins, HackMe Electronics, 2011
-	This file is part of Sprockit.
-
-    Sprockit is free software: you can redistribute it and/or modify
-    it under the terms of the GNU General Public License as published by
-    the Free Software Foundation, either version 3 of the License, or
-    (at your option) any later version.
-
-    Sprockit is distributed in the hope that it will be useful,
-    but WITHOUT ANY WARRANTY; without even the implied warranty of
-    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
-    GNU General Public License for more details.
-
-    You should have received a copy of the GNU General Public License
-    along with Sprockit.  If not, see <http://www.gnu.org/licenses/>
-*/
-
-
-#include <sprockit_main.h>
-#include <io.h>
-#include <oscillator.h>
-#include <interrupt.h>
-#include <interrupt_routines.h>
-#include <midi.h>
-#include <uart.h>
-#include <spi.h>
-#include <midi.h>
-#include <uart.h>
-#include <led_switch_handler.h>
-
-
-
-/*
-@brief This interrupt service routine handles Timer 2 - 8 bit timer compare match interrupts.
-This interrupt sets a flag which is checked in the main routine.  Setting this flag tells the main
-process to handle one of the auxiliary tasks.
-
-@param This routine takes no parameters and returns no value.
-*/
-
-ISR(TIMER2_COMPA_vect)
-{
-	static unsigned char uc_last_sample = 127;
-	static unsigned char uc_output = 127;
-
-	unsigned char 	uc_temp1, 
-					uc_temp2,
-					uc_sample;
-	unsigned int 	un_temp1,
-					un_temp2;
-
-	signed int		sn_low_pass_filter_calc;
-
-
-	OCR1BL = uc_output;
-
-	
-
-	//if the NoteOnFlag is set, we get a sample ready for output
-	if(1 == g_uc_note_on_flag)
-	{													
-		//If the sample reference is over the maximum, then subtract the maximum
-		//so that it wraps around
-		if(p_global_setting->aun_sample_reference[OSC_1] >= SAMPLE_MAX)
-		{
-			p_global_setting->aun_sample_reference[OSC_1] -= SAMPLE_MAX;
-		}
-
-		if(p_global_setting->aun_sample_reference[OSC_2] >= SAMPLE_MAX)
-		{
-			p_global_setting->aun_sample_reference[OSC_2] -= SAMPLE_MAX;
-		}
-		
-		//Get the sample value based on the waveshape, sample reference, 
-		//and the frequency index.	
-		uc_temp1 = oscillator(p_global_setting->auc_synth_params[OSC_1_WAVESHAPE],
-							p_global_setting->aun_sample_reference[OSC_1], 
-							p_global_setting->auc_midi_note_index[OSC_1]);
-		uc_temp2 = oscillator(p_global_setting->auc_synth_params[OSC_2_WAVESHAPE],
-							p_global_setting->aun_sample_reference[OSC_2], 
-							p_global_setting->auc_midi_note_index[OSC_2]);			
-
-		//mix the oscillators, by scaling each and adding them together
-		//the oscillator mix is controlled by the oscillator mix pot		
-		//there is an option to create a routine to run on the slow interrupt to precalculate the mix variables
-		//you could easily add more oscillators and add levels for each oscillator here
-		un_temp1 = uc_temp1*(255 - p_global_setting->auc_synth_params[OSC_MIX]);
-		
-		//scale the other oscillator
-		//using XOR for subtraction from 255 saves 19 clock cycles every time around
-		un_temp2 = uc_temp2*(p_global_setting->auc_synth_params[OSC_MIX]);
-	
-		un_temp1 += un_temp2;
-
-		//we scaled them by the oscillator mix, now add them together
-		uc_sample = un_temp1>>8;		
-	
-		g_uc_sample_request_flag = 0;
-
-
-		//low pass filter
-
-		sn_low_pass_filter_calc = uc_sample - uc_last_sample;
-		sn_low_pass_filter_calc >>= 2;
-		sn_low_pass_filter_calc += uc_last_sample;
-
-		uc_output = sn_low_pass_filter_calc;
-
-		uc_last_sample = uc_output;
-
-		//update the sampleReference which is used to tell where we are in the oscillator cycle
-		p_global_setting->aun_sample_reference[OSC_1] += p_global_setting->aun_note_frequency[OSC_1];
-		p_global_setting->aun_sample_reference[OSC_2] += p_global_setting->aun_note_frequency[OSC_2];
-	
-	}//end if statement
-	else
-	{
-		uc_output = 0;	
-		p_global_setting->aun_sample_reference[OSC_1] = 0;
-		p_global_setting->aun_sample_reference[OSC_2] = 0;
-	}
-}
-
-/*
-@brief 
-
-@param This routine takes no parameters and returns no value.
-*/
-ISR(TIMER0_COMPA_vect)
-{
-	g_uc_slow_interrupt_flag = 1;
-
-}
-
-/*
-@brief This interrupt service routine handles the Analog to Digital Converter conversion complete interrupts.
-When the the AD finishes a conversion, a flag is set and the main routine will start another conversion on
-a different pin, cycling through all the AD pins.
-
-@param This routine takes no parameters and returns no value.
-*/
-ISR(ADC_vect)
-{
-	g_uc_ad_ready_flag = TRUE;
-}
-
-/*
-@brief This interrupt service routine handles the SPI transmission interrupt.
-We have a buffer for SPI transmissions because all transmissions are at least two bytes and
-the AVR has no built-in hardware buffer. When the SPI transmission is configured by the transmitting
-routine, it loads the buffer and points the pointer to the right member for either two or three byte
-transmission.  We know the transmission is complete when the point points to a null value which is the
-end of the buffer.
-
-@param This routine takes no parameters and returns no value.
-*/
-ISR(SPI_STC_vect)
-{
-	//If the buffer is empty, set the ready flag for SPI
-	if(g_p_uc_spi_tx_buffer >= (g_p_uc_spi_tx_buffer_end))
-	{
-	  //Raise all the chip select lines
-	  PORTD |= CHIP_SELECT_MASK;
-	  g_uc_spi_ready_flag = 1;
-
-    }
-	//If the buffer is not empty, transmit the next byte.
-	else
-	{
-	  //Transmit the next byte.
-	  SPDR = *g_p_uc_spi_tx_buffer;
-	}
-
-    //Increment the pointer.
-	g_uc_spi_tx_buffer_index++;
-	g_p_uc_spi_tx_buffer = &g_auc_spi_tx_buffer[g_uc_spi_tx_buffer_index];
-
-}
-
-/*External interrupt 0 - LFO Shape*/
-ISR(INT0_vect)
-{
-	/*Disable interrupt so it doesn't repeat*/
-	DISABLE_EXT_INT_0;
-	
-	/*Set the external interrupt flag*/
-	g_uc_ext_int_0_flag = TRUE;
-	
-	/*Set the debounce timer to avoid getting unwanted triggers*/
-	g_un_switch_debounce_timer = 1000;
-}
-
-/*External interrupt 1 - LFO Destination*/
-ISR(INT1_vect)
-{
-	/*Disable interrupt so it doesn't repeat*/
-	DISABLE_EXT_INT_1;
-	
-	/*Set the external interrupt flag*/
-	g_uc_ext_int_1_flag = TRUE;
-	
-	/*Set the debounce timer to avoid getting unwanted triggers*/
-	g_un_switch_debounce_timer = 1000;
-}
-
+/*
+@file interrupt_routines.c
+
+@brief This module contains the interrupt routines.  These routines
+handles things like timer interrupts, switch press interrupts, 
+and spi transmission complete interrupts.
+
+
+@ Created by Matt Heins, HackMe Electronics, 2011
+	This file is part of Sprockit.
+
+    Sprockit is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Sprockit is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Sprockit.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+
+#include <sprockit_main.h>
+#include <io.h>
+#include <oscillator.h>
+#include <interrupt.h>
+#include <interrupt_routines.h>
+#include <midi.h>
+#include <uart.h>
+#include <spi.h>
+#include <midi.h>
+#include <uart.h>
+#include <led_switch_handler.h>
+#include <audio_block.h>
+
+
+#if AUDIO_BLOCK_RENDERING
+
+/*
+@brief This interrupt service routine handles Timer 2 - 8 bit timer compare match interrupts, the sample clock.
+The main loop has already rendered the samples into the output ring, so all that's left is to copy the next
+one into the PWM. If the ring is empty, the output holds where it is and we count an underrun.
+
+It's naked and written in assembly so that it saves only the three registers and SREG that it uses.
+About 40 cycles, where the compiler's version of rendering a sample here took hundreds.
+
+@param This routine takes no parameters and returns no value.
+*/
+ISR(TIMER2_COMPA_vect, ISR_NAKED)
+{
+	__asm__ __volatile__ (
+		"push r24"						"\n\t"
+		"in r24, __SREG__"				"\n\t"
+		"push r24"						"\n\t"
+		"push r30"						"\n\t"
+		"push r31"						"\n\t"
+		"lds r30, %[tail]"				"\n\t"
+		"lds r24, %[head]"				"\n\t"
+		"cp r30, r24"					"\n\t"
+		"breq 1f"						"\n\t"	//Empty ring, go count the underrun.
+		"ldi r31, 0"					"\n\t"
+		"subi r30, lo8(-(%[ring]))"		"\n\t"	//Z = &g_auc_audio_ring[tail]
+		"sbci r31, hi8(-(%[ring]))"		"\n\t"
+		"ld r24, Z"						"\n\t"
+		"sts %[ocr], r24"				"\n\t"	//OCR1BL = the sample
+		"lds r30, %[tail]"				"\n\t"
+		"inc r30"						"\n\t"
+		"andi r30, %[mask]"				"\n\t"
+		"sts %[tail], r30"				"\n\t"	//tail = (tail + 1) & AUDIO_RING_MASK
+		"rjmp 2f"						"\n\t"
+	"1:	lds r24, %[underruns]"			"\n\t"
+		"inc r24"						"\n\t"
+		"breq 2f"						"\n\t"	//Stick at 255 rather than wrap to 0.
+		"sts %[underruns], r24"			"\n\t"
+	"2:	pop r31"						"\n\t"
+		"pop r30"						"\n\t"
+		"pop r24"						"\n\t"
+		"out __SREG__, r24"				"\n\t"
+		"pop r24"						"\n\t"
+		"reti"							"\n\t"
+		:
+		: [tail] "i" (&g_uc_audio_ring_tail),
+		  [head] "i" (&g_uc_audio_ring_head),
+		  [ring] "i" (g_auc_audio_ring),
+		  [underruns] "i" (&g_uc_audio_underrun_count),
+		  [ocr] "n" (_SFR_MEM_ADDR(OCR1BL)),
+		  [mask] "M" (AUDIO_RING_MASK)
+	);
+}
+
+#else
+
+/*
+@brief This interrupt service routine handles Timer 2 - 8 bit timer compare match interrupts.
+This interrupt sets a flag which is checked in the main routine.  Setting this flag tells the main
+process to handle one of the auxiliary tasks.
+
+@param This routine takes no parameters and returns no value.
+*/
+
+ISR(TIMER2_COMPA_vect)
+{
+	static unsigned char uc_last_sample = 127;
+	static unsigned char uc_output = 127;
+
+	unsigned char 	uc_temp1, 
+					uc_temp2,
+					uc_sample;
+	unsigned int 	un_temp1,
+					un_temp2;
+
+	signed int		sn_low_pass_filter_calc;
+
+
+	OCR1BL = uc_output;
+
+	
+
+	//if the NoteOnFlag is set, we get a sample ready for output
+	if(1 == g_uc_note_on_flag)
+	{													
+		//A new note starts every oscillator's morph over.
+		if(g_uc_oscillator_midi_sync_flag == 1)
+		{
+			g_uc_oscillator_midi_sync_flag = 0;
+			oscillator_sync(&g_ast_oscillator_state[OSC_1], p_global_setting->auc_synth_params[OSC_1_WAVESHAPE]);
+			oscillator_sync(&g_ast_oscillator_state[OSC_2], p_global_setting->auc_synth_params[OSC_2_WAVESHAPE]);
+		}
+
+		//Get the sample value based on the waveshape, sample reference, 
+		//and the frequency index.	
+		uc_temp1 = oscillator(&g_ast_oscillator_state[OSC_1],
+							p_global_setting->auc_synth_params[OSC_1_WAVESHAPE],
+							(unsigned int)(p_global_setting->aul_sample_reference[OSC_1] >> 8), 
+							p_global_setting->auc_table_note[OSC_1]);
+		//OSC_2's phase is pushed around by OSC_1's sample for phase modulation
+		un_temp1 = p_global_setting->aul_sample_reference[OSC_2] >> 8;
+		un_temp1 += (signed char)(uc_temp1 ^ 0x80) * p_global_setting->auc_synth_params[PM_AMOUNT];
+
+		uc_temp2 = oscillator(&g_ast_oscillator_state[OSC_2],
+							p_global_setting->auc_synth_params[OSC_2_WAVESHAPE],
+							un_temp1, 
+							p_global_setting->auc_table_note[OSC_2]);			
+
+		//mix the oscillators, by scaling each and adding them together
+		//the oscillator mix is controlled by the oscillator mix pot		
+		//there is an option to create a routine to run on the slow interrupt to precalculate the mix variables
+		//you could easily add more oscillators and add levels for each oscillator here
+		un_temp1 = uc_temp1*(255 - p_global_setting->auc_synth_params[OSC_MIX]);
+		
+		//scale the other oscillator
+		//using XOR for subtraction from 255 saves 19 clock cycles every time around
+		un_temp2 = uc_temp2*(p_global_setting->auc_synth_params[OSC_MIX]);
+	
+		un_temp1 += un_temp2;
+
+		//we scaled them by the oscillator mix, now add them together
+		sn_low_pass_filter_calc = un_temp1>>8;
+
+		//The sub oscillator, OSC_1's phase shifted down an octave or two with its cycle count shifted in on top,
+		//centered on 0 and added to the mix
+		if(p_global_setting->auc_synth_params[SUB_LEVEL] != 0)
+		{
+			un_temp1 = p_global_setting->aul_sample_reference[OSC_1] >> 8;
+			uc_temp2 = p_global_setting->auc_table_note[OSC_1];
+
+			if(p_global_setting->auc_synth_params[SUB_MODE] & SUB_MODE_TWO_OCTAVES)
+			{
+				un_temp1 = ((unsigned int)p_global_setting->aul_sample_reference[OSC_SUB] << 14) | (un_temp1 >> 2);
+				uc_temp2 = (uc_temp2 > 24) ? uc_temp2 - 24 : 0;
+			}
+			else
+			{
+				un_temp1 = ((unsigned int)p_global_setting->aul_sample_reference[OSC_SUB] << 15) | (un_temp1 >> 1);
+				uc_temp2 = (uc_temp2 > 12) ? uc_temp2 - 12 : 0;
+			}
+
+			uc_temp1 = oscillator(&g_ast_oscillator_state[OSC_1],
+								(p_global_setting->auc_synth_params[SUB_MODE] & SUB_MODE_SIN) ? SIN : SQUARE,
+								un_temp1,
+								uc_temp2);
+
+			sn_low_pass_filter_calc += ((signed char)(uc_temp1 ^ 0x80) * p_global_setting->auc_synth_params[SUB_LEVEL]) >> 8;
+
+			if(sn_low_pass_filter_calc > 255)
+			{
+				sn_low_pass_filter_calc = 255;
+			}
+			else if(sn_low_pass_filter_calc < 0)
+			{
+				sn_low_pass_filter_calc = 0;
+			}
+		}
+
+		uc_sample = sn_low_pass_filter_calc;
+	
+		g_uc_sample_request_flag = 0;
+
+
+		//low pass filter
+
+		sn_low_pass_filter_calc = uc_sample - uc_last_sample;
+		sn_low_pass_filter_calc >>= 2;
+		sn_low_pass_filter_calc += uc_last_sample;
+
+		uc_output = sn_low_pass_filter_calc;
+
+		uc_last_sample = uc_output;
+
+		//update the sampleReference which is used to tell where we are in the oscillator cycle
+		//It wraps around at the end of the cycle by itself
+		p_global_setting->aul_sample_reference[OSC_1] += p_global_setting->aul_phase_increment[OSC_1];
+		p_global_setting->aul_sample_reference[OSC_2] += p_global_setting->aul_phase_increment[OSC_2];
+
+		//Hard sync, OSC_1 going past the end of its cycle starts OSC_2's over
+		if(p_global_setting->aul_sample_reference[OSC_1] & SAMPLE_REFERENCE_WRAP)
+		{
+			p_global_setting->aul_sample_reference[OSC_1] &= SAMPLE_REFERENCE_MASK;
+			p_global_setting->aul_sample_reference[OSC_SUB]++;
+
+			if(p_global_setting->auc_synth_params[OSC_SYNC] >= OSC_SYNC_ON)
+			{
+				p_global_setting->aul_sample_reference[OSC_2] = 0;
+			}
+		}
+	
+	}//end if statement
+	else
+	{
+		uc_output = 0;	
+		p_global_setting->aul_sample_reference[OSC_1] = 0;
+		p_global_setting->aul_sample_reference[OSC_2] = 0;
+		p_global_setting->aul_sample_reference[OSC_SUB] = 0;
+	}
+}
+
+#endif /*AUDIO_BLOCK_RENDERING*/
+
+/*
+@brief 
+
+@param This routine takes no parameters and returns no value.
+*/
+ISR(TIMER0_COMPA_vect)
+{
+	g_uc_slow_interrupt_flag = 1;
+	g_uc_slow_tick_count++;
+
+}
+
+/*
+@brief This interrupt service routine handles the Analog to Digital Converter conversion complete interrupts.
+When the the AD finishes a conversion, a flag is set and the main routine will start another conversion on
+a different pin, cycling through all the AD pins.
+
+@param This routine takes no parameters and returns no value.
+*/
+ISR(ADC_vect)
+{
+	g_uc_ad_ready_flag = TRUE;
+}
+
+/*
+@brief This interrupt service routine handles the SPI transmission interrupt.
+We have a buffer for SPI transmissions because all transmissions are at least two bytes and
+the AVR has no built-in hardware buffer. When the SPI transmission is configured by the transmitting
+routine, it loads the buffer and points the pointer to the right member for either two or three byte
+transmission.  We know the transmission is complete when the point points to a null value which is the
+end of the buffer.
+
+@param This routine takes no parameters and returns no value.
+*/
+ISR(SPI_STC_vect)
+{
+	//If the buffer is empty, set the ready flag for SPI
+	if(g_p_uc_spi_tx_buffer >= (g_p_uc_spi_tx_buffer_end))
+	{
+	  //Raise all the chip select lines
+	  PORTD |= CHIP_SELECT_MASK;
+	  g_uc_spi_ready_flag = 1;
+
+    }
+	//If the buffer is not empty, transmit the next byte.
+	else
+	{
+	  //Transmit the next byte.
+	  SPDR = *g_p_uc_spi_tx_buffer;
+	}
+
+    //Increment the pointer.
+	g_uc_spi_tx_buffer_index++;
+	g_p_uc_spi_tx_buffer = &g_auc_spi_tx_buffer[g_uc_spi_tx_buffer_index];
+
+}
+
+/*
+@brief This interrupt service routine handles the USART receive complete interrupt.
+The byte is moved straight into the receive ring buffer so the main loop can parse MIDI whenever it
+gets around to it. If the ring is full the byte is dropped and counted. The counters saturate at 255
+so a glance at them tells you whether anything has ever been lost.
+
+@param This routine takes no parameters and returns no value.
+*/
+ISR(USART_RX_vect)
+{
+	unsigned char	uc_status,
+					uc_byte,
+					uc_next_head,
+					uc_fill;
+
+	//The status has to be read before the data register or the error flags are lost.
+	uc_status = UCSR0A;
+	uc_byte = UDR0;
+
+	if((uc_status & (1<<DOR0)) && g_uc_uart_rx_hardware_overrun_count != 255)
+	{
+		g_uc_uart_rx_hardware_overrun_count++;
+	}
+
+	uc_next_head = (g_uc_uart_rx_head + 1) & UART_RX_BUFFER_MASK;
+
+	if(uc_next_head == g_uc_uart_rx_tail)
+	{
+		if(g_uc_uart_rx_overrun_count != 255)
+		{
+			g_uc_uart_rx_overrun_count++;
+		}
+	}
+	else
+	{
+		g_auc_uart_rx_buffer[g_uc_uart_rx_head] = uc_byte;
+		g_uc_uart_rx_head = uc_next_head;
+
+		uc_fill = (uc_next_head - g_uc_uart_rx_tail) & UART_RX_BUFFER_MASK;
+
+		if(uc_fill > g_uc_uart_rx_high_water_mark)
+		{
+			g_uc_uart_rx_high_water_mark = uc_fill;
+		}
+	}
+}
+
+/*External interrupt 0 - LFO Shape*/
+ISR(INT0_vect)
+{
+	/*Disable interrupt so it doesn't repeat*/
+	DISABLE_EXT_INT_0;
+	
+	/*Set the external interrupt flag*/
+	g_uc_ext_int_0_flag = TRUE;
+	
+	/*Set the debounce timer to avoid getting unwanted triggers*/
+	g_un_switch_debounce_timer = 1000;
+}
+
+/*External interrupt 1 - LFO Destination*/
+ISR(INT1_vect)
+{
+	/*Disable interrupt so it doesn't repeat*/
+	DISABLE_EXT_INT_1;
+	
+	/*Set the external interrupt flag*/
+	g_uc_ext_int_1_flag = TRUE;
+	
+	/*Set the debounce timer to avoid getting unwanted triggers*/
+	g_un_switch_debounce_timer = 1000;
+}
+
@@ -1,4 +1,4 @@
-
-#ifndef INTERRUPT_ROUTINES_H
-#define INTERRUPT_ROUTINES_H
-#endif /*INTERRUPT_ROUTINES_H*/
+
+#ifndef INTERRUPT_ROUTINES_H
+#define INTERRUPT_ROUTINES_H
+#endif /*INTERRUPT_ROUTINES_H*/
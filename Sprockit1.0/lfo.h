@@ -1,29 +1,40 @@
-/*
-	This file is part of Sprockit.
-
-    Sprockit is free software: you can redistribute it and/or modify
-    it under the terms of the GNU General Public License as published by
-    the Free Software Foundation, either version 3 of the License, or
-    (at your option) any later version.
-
-    Sprockit is distributed in the hope that it will be useful,
-    but WITHOUT ANY WARRANTY; without even the implied warranty of
-    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
-    GNU General Public License for more details.
-
-    You should have received a copy of the GNU General Public License
-    along with Sprockit.  If not, see <http://www.gnu.org/licenses/>
-*/
-
-#ifndef LFO_H
-#define LFO_H
-
-#define NUMBER_OF_LFOS			1
-
-extern const unsigned char auc_lfo_dest_decode[8];//lfo destination look-up table
-extern const unsigned int g_aun_lfo_rate_lut[32];//lfo rate look-up table
-
-void 
-lfo(g_setting *p_global_setting);
-
-#endif
+/*
+	This file is part of Sprockit.
+
+    Sprockit is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Sprockit is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Sprockit.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef LFO_H
+#define LFO_H
+
+#define NUMBER_OF_LFOS			1
+
+//LFO_SYNC settings
+#define LFO_SYNC_NOTE			1	//Restart the LFO on every note on
+#define LFO_SYNC_MIDI_CLOCK		2	//Lock the LFO to the MIDI clock. Anything from here up does the same.
+
+#define LFO_DEST_DECODE_ENTRIES	10	//Entries in auc_lfo_dest_decode. LFO_DEST values past the end get the last one.
+
+extern const unsigned char auc_lfo_dest_decode[LFO_DEST_DECODE_ENTRIES];//lfo destination look-up table
+extern const unsigned int g_aun_lfo_rate_lut[32];//lfo rate look-up table
+extern const unsigned char AUC_LFO_CLOCK_DIVISION_LUT[8];//lfo cycle length in MIDI clocks when locked to the MIDI clock
+
+//The parameter the LFO is pointed at. The tables above are in program memory.
+#define LFO_DESTINATION(p_setting)	pgm_read_byte(&auc_lfo_dest_decode[(p_setting)->auc_synth_params[LFO_DEST] < LFO_DEST_DECODE_ENTRIES ? \
+									(p_setting)->auc_synth_params[LFO_DEST] : LFO_DEST_DECODE_ENTRIES - 1])
+
+void 
+lfo(g_setting *p_global_setting);
+
+#endif
@@ -0,0 +1,240 @@
+/*
+@file midi_clock.c
+
+@brief This module follows the tempo of an external sequencer or drum machine from the MIDI
+timing clock, start and stop messages.
+
+The sender transmits 24 timing clocks per quarter note. Each clock is timestamped against the slow tick
+(3200Hz) and the time between clocks is smoothed, since the clocks themselves are jittery and we only see them
+once per slow tick anyway. Between clocks the position is moved forward every slow tick at the smoothed tempo,
+but never past where the next clock is due. When the clock shows up, the position snaps to it. That way the
+position never drifts further than a slow tick from the sender, however long it plays.
+
+The position is kept as a clock count (0 to MIDI_CLOCKS_PER_CYCLE - 1) plus a 16 bit fraction of a clock.
+Things that want to lock to the tempo, like the LFO and the arpeggiator, ask for where they are inside a cycle
+of however many clocks they like.
+
+This file is part of Sprockit.
+
+    Sprockit is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Sprockit is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Sprockit.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#include <sprockit_main.h>
+#include <midi.h>
+#include <midi_clock.h>
+
+static unsigned int un_midi_clock_index;			//Which clock of the cycle we are on
+static unsigned int un_midi_clock_fraction;			//How far we are between this clock and the next, 0 to 65535
+static unsigned int un_midi_clock_period;			//Smoothed slow ticks per clock, 8.8 fixed point
+static unsigned int un_midi_clock_fraction_increment;	//How far the fraction moves every slow tick
+static unsigned int un_midi_clock_ticks_since_clock;	//Slow ticks since the last clock arrived
+
+static unsigned char uc_midi_clock_locked;		//TRUE while clocks keep arriving
+static unsigned char uc_midi_clock_stopped;		//TRUE after a stop message, until start or continue
+static unsigned char uc_midi_clock_waiting;		//TRUE after a start message, until the first clock after it
+
+void
+midi_clock_init(void)
+{
+	un_midi_clock_index = 0;
+	un_midi_clock_fraction = 0;
+	un_midi_clock_period = 0;
+	un_midi_clock_fraction_increment = 0;
+	un_midi_clock_ticks_since_clock = MIDI_CLOCK_TIMEOUT_TICKS;
+	uc_midi_clock_locked = FALSE;
+	uc_midi_clock_stopped = FALSE;
+	uc_midi_clock_waiting = FALSE;
+}
+
+/*
+@brief This function handles a timing clock. It updates the smoothed tempo from the time since the last
+clock and snaps the position to the clock.
+
+@param Nothing.
+
+@return Nothing.
+*/
+static void
+midi_clock_handle_timing_clock(void)
+{
+	unsigned int un_interval;
+	signed long sl_error;
+
+	//Only the time between two clocks in a row tells us anything about the tempo.
+	if(un_midi_clock_ticks_since_clock < MIDI_CLOCK_TIMEOUT_TICKS)
+	{
+		un_interval = un_midi_clock_ticks_since_clock << 8;
+
+		if(un_interval >= MIDI_CLOCK_MIN_PERIOD)
+		{
+			sl_error = (signed long)un_interval - un_midi_clock_period;
+
+			/*The first interval, or a big tempo change, is taken as is. Otherwise we only move a little way
+			toward the new interval to smooth out the jitter.*/
+			if(uc_midi_clock_locked == FALSE ||
+			   sl_error > (un_midi_clock_period >> 2) || sl_error < -(signed long)(un_midi_clock_period >> 2))
+			{
+				un_midi_clock_period = un_interval;
+			}
+			else
+			{
+				un_midi_clock_period += (signed int)(sl_error >> LOG_MIDI_CLOCK_SMOOTHING);
+			}
+
+			//A clock is 65536 fraction counts. Divide that over the ticks it takes. 8.8 period, so 2^24.
+			un_midi_clock_fraction_increment = 16777216UL / un_midi_clock_period;
+			uc_midi_clock_locked = TRUE;
+		}
+	}
+
+	un_midi_clock_ticks_since_clock = 0;
+
+	if(uc_midi_clock_stopped == FALSE)
+	{
+		//The first clock after a start is the downbeat.
+		if(uc_midi_clock_waiting == TRUE)
+		{
+			uc_midi_clock_waiting = FALSE;
+			un_midi_clock_index = 0;
+		}
+		else
+		{
+			un_midi_clock_index++;
+
+			if(un_midi_clock_index >= MIDI_CLOCKS_PER_CYCLE)
+			{
+				un_midi_clock_index = 0;
+			}
+		}
+
+		un_midi_clock_fraction = 0;
+	}
+}
+
+/*
+@brief This function handles the MIDI system real time bytes. It's called straight from the byte parser
+because real time bytes come in between the bytes of other messages and don't go in the message fifo.
+
+@param The real time byte.
+
+@return Nothing.
+*/
+void
+midi_clock_handle_real_time_byte(unsigned char uc_the_byte)
+{
+	switch(uc_the_byte)
+	{
+		case MIDI_TIMING_CLOCK:
+
+			midi_clock_handle_timing_clock();
+
+		break;
+
+		case MIDI_REAL_TIME_START:
+
+			//Back to the top. Hold there until the first clock.
+			un_midi_clock_index = 0;
+			un_midi_clock_fraction = 0;
+			uc_midi_clock_stopped = FALSE;
+			uc_midi_clock_waiting = TRUE;
+
+		break;
+
+		case MIDI_REAL_TIME_CONTINUE:
+
+			uc_midi_clock_stopped = FALSE;
+
+		break;
+
+		case MIDI_REAL_TIME_STOP:
+
+			uc_midi_clock_stopped = TRUE;
+
+		break;
+
+		default:
+
+		break;
+	}
+}
+
+/*
+@brief This function has to run once every slow tick. It moves the position along between clocks at the
+smoothed tempo and notices when the clocks have gone away.
+
+@param Nothing.
+
+@return Nothing.
+*/
+void
+midi_clock_tick(void)
+{
+	unsigned int un_fraction;
+
+	if(un_midi_clock_ticks_since_clock < MIDI_CLOCK_TIMEOUT_TICKS)
+	{
+		un_midi_clock_ticks_since_clock++;
+	}
+	else
+	{
+		uc_midi_clock_locked = FALSE;
+	}
+
+	if(uc_midi_clock_locked == TRUE && uc_midi_clock_stopped == FALSE && uc_midi_clock_waiting == FALSE)
+	{
+		//Don't run past the next clock. If it's late we wait for it rather than get ahead.
+		un_fraction = un_midi_clock_fraction + un_midi_clock_fraction_increment;
+
+		if(un_fraction < un_midi_clock_fraction)
+		{
+			un_fraction = 0xFFFF;
+		}
+
+		un_midi_clock_fraction = un_fraction;
+	}
+}
+
+//This returns TRUE while we are following an external clock.
+unsigned char
+midi_clock_is_locked(void)
+{
+	return uc_midi_clock_locked;
+}
+
+//This returns which clock of the cycle we are on, 0 to MIDI_CLOCKS_PER_CYCLE - 1.
+unsigned int
+midi_clock_get_clock_index(void)
+{
+	return un_midi_clock_index;
+}
+
+/*
+@brief This function tells a tempo-locked routine where it is in its cycle.
+
+@param The length of the cycle in clocks, 1 to 255. 24 is a quarter note, 96 is a bar. It should divide
+MIDI_CLOCKS_PER_CYCLE or there will be a jump when the clock count wraps.
+
+@return The position in the cycle, 0 to 65535.
+*/
+unsigned int
+midi_clock_get_cycle_position(unsigned char uc_clocks_per_cycle)
+{
+	unsigned int un_position;
+
+	//Clocks into the cycle in the top byte, fraction of a clock in the bottom byte.
+	un_position = (un_midi_clock_index % uc_clocks_per_cycle) << 8;
+	un_position |= un_midi_clock_fraction >> 8;
+
+	return ((unsigned long)un_position << 8) / uc_clocks_per_cycle;
+}
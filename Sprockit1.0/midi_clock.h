@@ -0,0 +1,47 @@
+/*
+	This file is part of Sprockit.
+
+    Sprockit is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Sprockit is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Sprockit.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef MIDI_CLOCK_H
+#define MIDI_CLOCK_H
+
+#define MIDI_CLOCKS_PER_QUARTER_NOTE	24
+#define MIDI_CLOCKS_PER_CYCLE			384		//4 bars of 4/4. Clock divisions that divide this stay in phase when the count wraps.
+#define MIDI_CLOCK_TIMEOUT_TICKS		255		//Slow ticks without a clock before we stop following it. The period is 8.8 in 16 bits, so
+												//this is also the slowest clock we can follow, about 31 BPM.
+#define MIDI_CLOCK_MIN_PERIOD			(2<<8)	//Clocks closer together than two slow ticks (over 4000 BPM) are garbage.
+#define LOG_MIDI_CLOCK_SMOOTHING		3		//The period follows 1/8 of each new interval.
+
+//Function prototypes
+void
+midi_clock_init(void);
+
+void
+midi_clock_handle_real_time_byte(unsigned char uc_the_byte);
+
+void
+midi_clock_tick(void);
+
+unsigned char
+midi_clock_is_locked(void);
+
+unsigned int
+midi_clock_get_clock_index(void);
+
+unsigned int
+midi_clock_get_cycle_position(unsigned char uc_clocks_per_cycle);
+
+#endif /*MIDI_CLOCK_H*/
@@ -1,724 +1,1430 @@
-/* 
-@file oscillator.c
-
-@brief
-
-This file contains the oscillator function which generates waveforms from wavetables and from 
-resynthesizing wavetables to make for big fun. If you wanna, this is one of the most fun
-places to play around because you can get truly creative and get really new sounds. Cheers!
-
-@ Created by Matt Heins, HackMe Electronics, 2011
-This file is part of Sprockit.
-
-    Sprockit is free software: you can redistribute it and/or modify
-    it under the terms of the GNU General Public License as published by
-    the Free Software Foundation, either version 3 of the License, or
-    (at your option) any later version.
-
-    Sprockit is distributed in the hope that it will be useful,
-    but WITHOUT ANY WARRANTY; without even the implied warranty of
-    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
-    GNU General Public License for more details.
-
-    You should have received a copy of the GNU General Public License
-    along with Sprockit.  If not, see <http://www.gnu.org/licenses/>
-*/
-
-#include <sprockit_main.h>
-#include <pgmspace.h>
-#include <oscillator.h>
-#include <wavetables.h>
-#include <amp_adsr.h>
-
-/*This oscillator lookup array changes oscillator 2 based on the setting for oscillator 1. It
-also sets the oscillator mix between the two oscillators. This setting of oscillator 2 only
-happens if the oscillator shape has not been */
-const unsigned char AUC_OSCILLATOR_LUT [32][3] = {
-{0,0,0,},//0
-{1,0,0,},//1
-{2,0,0,},//2
-{3,0,0,},//3
-{4,0,0,},//4
-{5,0,0,},//5
-{6,0,0,},//6
-{0,0,127,},//7
-{1,3,127,},//8
-{1,0,127,},//9
-{1,1,127,},//10
-{2,1,127,},//11
-{3,1,127,},//12
-{4,1,127,},//13
-{2,2,127,},//14
-{3,2,127,},//15
-{6,6,127,},//16
-{7,7,127,},//17
-{3,3,127,},//18
-{4,4,127,},//19
-{4,5,127,},//20
-{5,7,127,},//21
-{14,14,127,},//22
-{15,7,127,},//23
-{10,10,127,},//24
-{11,6,127,},//25
-{12,10,127,},//26
-{13,13,127,},//27
-{6,9,127,},//28
-{1,14,127,},//29
-{1,15,32,},//30
-{15,15,127}};//31
-
-/*
-Function: decode_oscillator_waveshape
-Takes: 
-g_setting *p_global_setting - The global synthesizer setting array.
-unsigned char ucwaveshape - This tells the function the setting of the oscillator pot.
-      
-Returns: Nothing.
-
-This function takes the setting of the oscillator pot knob and decodes it to set the waveshape
-for each oscillator and the oscillator mix parameter.
-*/
-void
-decode_oscillator_waveshape(volatile g_setting *p_global_setting, unsigned char ucwaveshape)
-{
-	ucwaveshape = ucwaveshape >> 3;//32 waveshapes
-	
-	p_global_setting->auc_synth_params[OSC_1_WAVESHAPE] = AUC_OSCILLATOR_LUT[ucwaveshape][OSCILLATOR_1];
-	
-	if(p_global_setting->auc_parameter_source[OSC_2_WAVESHAPE] == SOURCE_AD)
-	{
-		p_global_setting->auc_synth_params[OSC_2_WAVESHAPE] = AUC_OSCILLATOR_LUT[ucwaveshape][OSCILLATOR_2];
-	}
-	
-	if(p_global_setting->auc_parameter_source[OSC_MIX] == SOURCE_AD)
-	{
-		p_global_setting->auc_synth_params[OSC_MIX] = AUC_OSCILLATOR_LUT[ucwaveshape][OSCILLATOR_MIX];
-	}
-}
-
-/*
-Function: oscillator
-Takes: unsigned char ucwaveshape - This tells the function which waveshape to generate
-       unsigned int unsample_reference - This tells the function where we are in the wave cycle
-
-Returns: unsigned char - An eight bit unsigned sample value.
-
-This function takes a waveshape variable, a sample reference (where we are in the cycle), and a frequency 
-and returns an appropriate 8 bit value for that point in the cycle.  It may take a wavetable directly, or 
-add some together or some other math function to make some new time-varying waveshape.
-
-*/
-unsigned char 
-oscillator(unsigned char uc_waveshape, unsigned int un_sample_reference, unsigned char uc_frequency){
-	
-	unsigned char	uc_temp,
-					uc_interpolate_sample_1,
-					uc_interpolate_sample_2,
-					uc_interpolate_reference,
-					uc_sample = 0,
-					uc_morph_sample_1 = 0,
-					uc_morph_sample_2 = 0,
-					lfsr_bit,
-					uc_sample_index,
-					uc_table_modulus,
-					uc_reverse_sample_index,
-					uc_pitch_shift;
-					
-	unsigned int	un_temp,
-					un_temp2,
-					un_sample_calc = 0;
-					
-	signed int sn_temp;
-					
-	static unsigned char uc_morph_timer,
-						 uc_morph_index,
-						 uc_morph_state,
-						 uc_phase_shifter,
-						 uc_phase_shift_timer;
-						 
-	static unsigned int un_morph_index,
-						un_morph_timer,
-						lfsr = 0xACE1; 
-	
-	
-	/*Some of the code in this file has not been space optimized. I did this to make it easier for me to develop. Work
-	can be done to decrease the size of this code by creating functions to handle wavetable blending and morphing.*/
-
-	/*The morph timer is used to control the change between different waveshapes. Each tick of the morph timer
-	is one sample period. In this case, one morph timer increment is 1/32768 = 30 microseconds.*/
-	
-	if(g_uc_oscillator_midi_sync_flag == 1)
-	{
-		g_uc_oscillator_midi_sync_flag = 0;
-		uc_morph_state = 0;
-		
-		un_morph_index = 0;
-		uc_morph_timer = 0;
-		
-		uc_pitch_shift = 0;
-	
-		if(uc_waveshape !=  MORPH_7)
-		{
-			uc_morph_index = 0;
-		}
-	}
-
-
-	/*Wavetable Blending Explained:
-	A bunch of the wavetables below have blending going on. Rather than explain it every time. Here's
-	what's going on.
-	The wavetables are set up with 32 tables for 128 notes, that is 4 notes per table.
-	In order to smooth the transition from table to table, we need to blend the tables together.
-	We make a weighted average of 4 samples. 
-	1st note = half current table + half table below/2
-	2nd note = 3* current table + 1 from table below /4
-	3rd note = 3* current table + 1 from table above
-	4th note = half current table + half from table above /2
-	Not so hard, n'est-ce pas?
-	*/
-					
-	//switch statment for different waveshapes
-	switch(uc_waveshape)
-	{
-		//Sin values are in a lookup table generated by calculating one cycle of a sine wave 
-		case SIN:
-			
-			uc_temp = un_sample_reference >> 7;
-			
-			//To interpolate, we need the remainder which is what's discarded above.
-			uc_interpolate_reference = un_sample_reference & 0x7F;
-			
-			//We need the first sample.
-			uc_interpolate_sample_1 = G_AUC_SIN_LUT[uc_temp];
-
-			//We need to get the next sample.
-			uc_temp++;
-
-			uc_interpolate_sample_2 = G_AUC_SIN_LUT[uc_temp];
-						
-			uc_sample = linear_interpolate(uc_interpolate_reference, uc_interpolate_sample_1, uc_interpolate_sample_2);
-		
-		break;
-
-		case SQUARE:
-	
-			uc_frequency >>= 2;//Only 32 tables
-			uc_sample_index = un_sample_reference>>7;//shift from 32768 to 256
-			
-			uc_sample = calculate_square(uc_sample_index,uc_frequency,127);
-			
-		break;
-							
-		case RAMP:
-			
-			uc_table_modulus = uc_frequency%4;
-			uc_frequency >>= 2;//Only 32 tables
-			uc_sample_index = un_sample_reference>>7;//shift from 32768 to 256
-			
-			/*This operation blends wavetables to minimize moving aliasing as the keyboard is played*/
-			switch(uc_table_modulus)
-			{
-				case 0:
-
-					un_sample_calc = pgm_read_byte(&G_AUC_RAMP_WAVETABLE_LUT[uc_frequency][uc_sample_index]);
-					uc_frequency--;
-					un_sample_calc += pgm_read_byte(&G_AUC_RAMP_WAVETABLE_LUT[uc_frequency][uc_sample_index]);
-					un_sample_calc >>= 1;
-
-				break;
-
-				case 1:
-
-					un_sample_calc = pgm_read_byte(&G_AUC_RAMP_WAVETABLE_LUT[uc_frequency][uc_sample_index]);
-					un_sample_calc *= 3;
-					uc_frequency--;
-					un_sample_calc += pgm_read_byte(&G_AUC_RAMP_WAVETABLE_LUT[uc_frequency][uc_sample_index]);
-					un_sample_calc >>= 2;
-
-				break;
-
-				case 2:
-
-					un_sample_calc = pgm_read_byte(&G_AUC_RAMP_WAVETABLE_LUT[uc_frequency][uc_sample_index]);
-					un_sample_calc *= 3;
-					uc_frequency++;
-					un_sample_calc += pgm_read_byte(&G_AUC_RAMP_WAVETABLE_LUT[uc_frequency][uc_sample_index]);
-					un_sample_calc >>= 2;
-
-				break;
-
-				case 3:
-					un_sample_calc = pgm_read_byte(&G_AUC_RAMP_WAVETABLE_LUT[uc_frequency][uc_sample_index]);
-					uc_frequency++;
-					un_sample_calc += pgm_read_byte(&G_AUC_RAMP_WAVETABLE_LUT[uc_frequency][uc_sample_index]);
-					un_sample_calc >>= 1;
-
-				break;
-
-				default:
-				
-					un_sample_calc = 0;
-
-				break;
-
-			}
-			
-			uc_sample = (unsigned char) un_sample_calc;		
-		
-		break;
-
-						
-		case TRIANGLE:
-
-			uc_table_modulus = uc_frequency%4;
-			uc_frequency >>= 2;//Only 32 tables
-			uc_sample_index = un_sample_reference>>7;//shift from 32768 to 256
-			
-			/*This operation blends wavetables to minimize moving aliasing as the keyboard is played*/
-			switch(uc_table_modulus)
-			{
-				case 0:
-
-					un_sample_calc = pgm_read_byte(&G_AUC_TRIANGLE_WAVETABLE_LUT[uc_frequency][uc_sample_index]);
-					uc_frequency--;
-					un_sample_calc += pgm_read_byte(&G_AUC_TRIANGLE_WAVETABLE_LUT[uc_frequency][uc_sample_index]);
-					un_sample_calc >>= 1;
-
-				break;
-
-				case 1:
-
-					un_sample_calc = pgm_read_byte(&G_AUC_TRIANGLE_WAVETABLE_LUT[uc_frequency][uc_sample_index]);
-					un_sample_calc *= 3;
-					uc_frequency--;
-					un_sample_calc += pgm_read_byte(&G_AUC_TRIANGLE_WAVETABLE_LUT[uc_frequency][uc_sample_index]);
-					un_sample_calc >>= 2;
-
-				break;
-
-				case 2:
-
-					un_sample_calc = pgm_read_byte(&G_AUC_TRIANGLE_WAVETABLE_LUT[uc_frequency][uc_sample_index]);
-					un_sample_calc *= 3;
-					uc_frequency++;
-					un_sample_calc += pgm_read_byte(&G_AUC_TRIANGLE_WAVETABLE_LUT[uc_frequency][uc_sample_index]);
-					un_sample_calc >>= 2;
-
-				break;
-
-				case 3:
-					un_sample_calc = pgm_read_byte(&G_AUC_TRIANGLE_WAVETABLE_LUT[uc_frequency][uc_sample_index]);
-					uc_frequency++;
-					un_sample_calc += pgm_read_byte(&G_AUC_TRIANGLE_WAVETABLE_LUT[uc_frequency][uc_sample_index]);
-					un_sample_calc >>= 1;
-
-				break;
-
-				default:
-				
-					un_sample_calc = 0;
-
-				break;
-
-			}
-			
-			uc_sample = (unsigned char) un_sample_calc;	
-				
-		break;
-					
-
-		case MORPH_1:
-			
-			uc_frequency >>= 2;//Only 32 tables
-			uc_sample_index = un_sample_reference>>7;//shift from 32768 to 256
-
-			if(uc_morph_timer == 0)
-			{
-				uc_morph_index++;
-				uc_morph_timer = 10;
-			}
-
-			uc_morph_timer--;
-		
-			uc_morph_sample_1 = calculate_square(uc_sample_index,uc_frequency,uc_morph_index);
-
-			uc_sample_index += 127;
-			
-			uc_morph_sample_2 = pgm_read_byte(&G_AUC_RAMP_WAVETABLE_LUT[uc_frequency][uc_sample_index]);
-
-			un_temp = uc_morph_sample_1*uc_morph_index;
-			un_temp2 = uc_morph_sample_2*(255 - uc_morph_index);
-
-			un_temp += un_temp2;
-
-			uc_sample = un_temp >> 8;
-
-		break;
-
-		case MORPH_2:
-
-			uc_frequency >>= 2;//Only 32 tables
-			uc_sample_index = un_sample_reference>>7;//shift from 32768 to 256
-
-			if(uc_morph_timer == 0)
-			{
-				uc_morph_index++;
-				
-				uc_morph_timer = MORPH_2_TIME_PERIOD;
-			}
-
-			uc_morph_timer--;
-
-			uc_phase_shift_timer--;
-
-			if(uc_phase_shift_timer == 0)
-			{
-				uc_phase_shifter++;
-				
-				uc_phase_shift_timer = PHASE_SHIFT_TIMER_2;
-			}
-			
-			uc_morph_sample_1 = pgm_read_byte(&G_AUC_TRIANGLE_WAVETABLE_LUT[uc_frequency][uc_sample_index]);
-
-			uc_sample_index += uc_phase_shifter;
-			
-			uc_morph_sample_2 = pgm_read_byte(&G_AUC_RAMP_WAVETABLE_LUT[uc_frequency][uc_sample_index]);
-
-			un_temp = uc_morph_sample_1*uc_morph_index;
-			un_temp2 = uc_morph_sample_2*(255 - uc_morph_index);
-
-			un_temp += un_temp2;
-
-			uc_sample = un_temp >> 8;
-
-		break;
-
-		case MORPH_3:
-				
-			uc_frequency >>= 2;//Only 32 tables
-			uc_sample_index = un_sample_reference>>7;//shift from 32768 to 256
-			
-			if(uc_morph_timer == 0)
-			{
-				uc_morph_index++;
-				uc_morph_timer = 50;
-			}
-
-			uc_morph_timer--;
-			
-			uc_reverse_sample_index = uc_sample_index - uc_morph_index;
-			
-			uc_temp = pgm_read_byte(&G_AUC_TRIANGLE_WAVETABLE_LUT[uc_frequency][uc_sample_index]);
-		
-			sn_temp = uc_temp - pgm_read_byte(&G_AUC_RAMP_WAVETABLE_LUT[uc_frequency][uc_reverse_sample_index]);
-
-			/*Now we'll have a positive or negative number. We have to center it around 127 and make sure
-			that the sample is never going to be over 255 or less than 0.*/
-			if(sn_temp > 127)
-			{
-				uc_sample = 255;
-			}
-			else if(sn_temp < -128)
-			{
-				uc_sample = 0;
-			}
-			else
-			{
-				uc_sample = 128 + sn_temp;
-			}
-
-		break;
-		
-		case MORPH_4:
-
-			uc_frequency >>= 2;//Only 32 tables
-			uc_sample_index = un_sample_reference>>7;//shift from 32768 to 256
-		
-			if(uc_morph_timer == 0)
-			{
-				if(uc_morph_state == 0)
-				{
-					uc_morph_index++;
-
-					if(uc_morph_index == 255)
-					{
-						uc_morph_state = 1;
-					}
-				}
-				else
-				{
-					uc_morph_index--;
-
-					if(uc_morph_index == 0)
-					{
-						uc_morph_state = 0;
-					}
-				}
-
-				uc_morph_timer = 250;
-			}
-
-			uc_morph_timer--;
-			
-			uc_sample = calculate_square(uc_sample_index,uc_frequency,uc_morph_index);
-
-		break;
-		
-		case MORPH_5:
-		
-			uc_frequency >>= 2;//Only 32 tables
-			uc_sample_index = un_sample_reference>>7;//shift from 32768 to 256
-
-			if(uc_morph_timer == 0)
-			{
-				un_morph_index++;
-				uc_morph_timer = 10;
-			}
-
-			uc_morph_timer--;
-			
-			/*First enveloped oscillator*/
-			if(un_morph_index < 255)
-			{
-				un_sample_calc = G_AUC_SIN_LUT[uc_sample_index];
-				un_sample_calc *= G_AUC_RAMP_SIMPLE_WAVETABLE_LUT[un_morph_index];
-				un_sample_calc >>= 8;
-				uc_morph_sample_1 = (unsigned char) un_sample_calc;
-			}				
-			
-			if(un_morph_index > 128 && un_morph_index < 383)
-			{
-				uc_temp = un_morph_index - 128;				
-				
-				un_sample_calc = calculate_square(uc_sample_index,uc_frequency,uc_morph_index);
-				un_sample_calc *= 255 - G_AUC_SIN_LUT[uc_temp];
-				un_sample_calc >>= 8;
-				uc_morph_sample_2 = (unsigned char) un_sample_calc;
-				
-			}
-			
-			un_sample_calc = uc_morph_sample_1 + uc_morph_sample_2;
-			un_sample_calc = un_sample_calc >> 1;
-			uc_sample = (unsigned char) un_sample_calc;
-
-			if(un_morph_index == 383)
-			{
-				un_morph_index = 0;
-			}
-		
-		break;
-		
-		case MORPH_6:
-		
-			uc_frequency >>= 2;//Only 32 tables
-			uc_sample_index = un_sample_reference>>7;//shift from 32768 to 256
-
-			if(uc_morph_timer == 0)
-			{
-				un_morph_index++;
-				uc_morph_timer = 50;
-			}
-
-			uc_morph_timer--;
-			
-			/*First enveloped oscillator*/
-			if(un_morph_index < 255)
-			{
-				un_sample_calc = G_AUC_RAMP_SIMPLE_WAVETABLE_LUT[uc_sample_index];
-				un_sample_calc *= G_AUC_RAMP_SIMPLE_WAVETABLE_LUT[un_morph_index];
-				un_sample_calc >>= 8;
-				uc_morph_sample_1 = (unsigned char) un_sample_calc;
-			}				
-			
-			if(un_morph_index > 128 && un_morph_index < 383)
-			{
-				uc_temp = un_morph_index - 128;
-				un_sample_calc = calculate_square(uc_sample_index,uc_frequency,uc_morph_index);
-				un_sample_calc *= 255 - G_AUC_SIN_LUT[uc_temp];
-				un_sample_calc >>= 8;
-				uc_morph_sample_2 = (unsigned char) un_sample_calc;
-				
-			}
-			
-			un_sample_calc = uc_morph_sample_1 + uc_morph_sample_2;
-			un_sample_calc = un_sample_calc >> 1;
-			uc_sample = (unsigned char) un_sample_calc;
-
-			if(un_morph_index == 383)
-			{
-				un_morph_index = 0;
-			}
-		
-		break;
-		
-		case MORPH_7:
-		
-			/*This morphing waveshape is a square wave with varying pulse width.*/
-		
-			uc_frequency >>= 2;//Only 32 tables
-			uc_sample_index = un_sample_reference>>7;//shift from 32768 to 256
-		
-			/*This morphing waveshape is a square wave of varying pulse width*/
-			if(uc_morph_timer == 0)
-			{
-				uc_morph_index++;
-				uc_morph_timer = 25;
-			}
-
-			uc_morph_timer--;
-			
-			uc_sample = calculate_square(uc_sample_index,uc_frequency,uc_morph_index);
-			
-		break;
-		
-		case MORPH_8:
-		
-			uc_frequency >>= 2;//Only 32 tables
-			uc_sample_index = un_sample_reference>>7;//shift from 32768 to 256
-			
-			if(un_morph_timer == 0)
-			{
-				uc_morph_index++;
-				un_morph_timer = 4000;
-				
-			}
-			
-			un_morph_timer--;		
-			uc_sample = calculate_square(uc_sample_index,uc_frequency,uc_morph_index);
-			
-			
-		break;
-
-		case MORPH_9:
-
-			uc_frequency >>= 2;//Only 32 tables
-			uc_sample_index = un_sample_reference>>7;//shift from 32768 to 256
-				
-			if(uc_morph_timer == 0)
-			{
-				uc_morph_index++;
-				uc_morph_timer = 10;
-			}
-
-			uc_morph_timer--;
-					
-			uc_sample = calculate_square(uc_sample_index,uc_frequency,uc_morph_index);
-		
-		break;
-
-		case HARD_SYNC:
-
-			uc_frequency >>= 3;
-			uc_sample_index = un_sample_reference>>8;
-			uc_sample = calculate_square(uc_sample_index,uc_frequency,126);
-
-		break;
-
-
-		case NOISE:
-
-			/*A pseudo random number is generated using a linear feedback shift register
-			The polynomial expression used is: x^16 + x^14 + x^13 + x^11 + 1*/
-
-			lfsr_bit = ((lfsr >> 15) ^ (lfsr >> 13) ^ (lfsr ^ 12) ^ (lfsr >> 10)) & 1;
-			lfsr = (lfsr << 1) | (lfsr_bit); 
-        
-			uc_sample = (unsigned char) lfsr;
-
-		break;
-		
-		case RAW_SQUARE:
-
-			if(un_sample_reference > HALF_SAMPLE_MAX)
-			{
-				uc_sample = 255;
-			}
-			else
-			{
-				uc_sample = 0;
-			}
-
-		break;
-
-
-		default:
-
-			uc_temp = un_sample_reference >> 7;				
-			uc_sample = G_AUC_SIN_LUT[uc_temp];
-		
-		break;
-
-	}
-
- 	return uc_sample;
-				
-}
-
-
-/*
-calculate_square
-@brief This function calculates a square wave by summing two out of phase ramp waves. 
-The duty cycle of the square wave is adjustable.
-
-@param  uc_sample_index - This tells the function which sample to access on the time scale.
-		uc_frequency - This tells the function which wavetable to access on the MIDI scale.
-		uc_pulse_width - This determines the pulse_width. 0 = 50%, 127 = 1%
-
-@return It returns an appropriate square wave sample value.
-*/
-unsigned char
-calculate_square(unsigned char uc_sample_index, unsigned char uc_frequency, unsigned char uc_pulse_width)
-{
-	unsigned char uc_temp,
-				  uc_sample,
-				  uc_reverse_sample_index;
-	signed int sn_temp;
-	
-	uc_reverse_sample_index = uc_sample_index - uc_pulse_width;
-			
-	uc_temp = pgm_read_byte(&G_AUC_RAMP_WAVETABLE_LUT[uc_frequency][uc_sample_index]);
-		
-	sn_temp = uc_temp - pgm_read_byte(&G_AUC_RAMP_WAVETABLE_LUT[uc_frequency][uc_reverse_sample_index]);
-
-	/*Now we'll have a positive or negative number. We have to center it around 127 and make sure
-	that the sample is never going to be over 255 or less than 0.*/
-	if(sn_temp > 127)
-	{
-		uc_sample = 255;
-	}
-	else if(sn_temp < -128)
-	{
-		uc_sample = 0;
-	}
-	else
-	{
-		uc_sample = 128 + sn_temp;
-	}
-	
-	return uc_sample;
-}
-
-
-/*
-Linear Interpolation
-The top 8 bits give us the index = x1
-The bottom 8 bits give us the next index = x2
-So, we add x1 + (x1-x2)*(bottom 7 bits)/128	
-*/	
-unsigned char 
-linear_interpolate(unsigned char uc_reference, unsigned char uc_sample_1, unsigned char uc_sample_2)
-{
-	signed int sn_difference;
-	unsigned char uc_result;
-		
-	sn_difference = uc_sample_2 - uc_sample_1;
-	
-	sn_difference *= uc_reference;
-	
-	sn_difference >>= 8;
-	
-	uc_result = uc_sample_1 + sn_difference;
-
-	return uc_result;
-	
-}
+/* 
+@file oscillator.c
+
+@brief
+
+This file contains the oscillator function which generates waveforms from wavetables and from 
+resynthesizing wavetables to make for big fun. If you wanna, this is one of the most fun
+places to play around because you can get truly creative and get really new sounds. Cheers!
+
+@ Created by Matt Heins, HackMe Electronics, 2011
+This file is part of Sprockit.
+
+    Sprockit is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Sprockit is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Sprockit.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#include <io.h>
+#include <sprockit_main.h>
+#include <pgmspace.h>
+#include <oscillator.h>
+#include <wavetables.h>
+#include <amp_adsr.h>
+
+/*This oscillator lookup array changes oscillator 2 based on the setting for oscillator 1. It
+also sets the oscillator mix between the two oscillators, and whether oscillator 2 is hard synced
+to oscillator 1. This setting of oscillator 2 only happens if the oscillator shape has not been */
+const unsigned char AUC_OSCILLATOR_LUT [32][4] PROGMEM = {
+{0,0,0,0,},//0
+{1,0,0,0,},//1
+{2,0,0,0,},//2
+{3,0,0,0,},//3
+{4,0,0,0,},//4
+{5,0,0,0,},//5
+{6,0,0,0,},//6
+{0,0,127,0,},//7
+{1,3,127,0,},//8
+{1,0,127,0,},//9
+{1,1,127,0,},//10
+{2,1,127,0,},//11
+{3,1,127,0,},//12
+{4,1,127,0,},//13
+{2,2,127,0,},//14
+{3,2,127,0,},//15
+{6,6,127,0,},//16
+{7,7,127,0,},//17
+{3,3,127,0,},//18
+{4,4,127,0,},//19
+{4,5,127,0,},//20
+{5,7,127,0,},//21
+{14,14,127,0,},//22
+{15,7,127,0,},//23
+{10,10,127,0,},//24
+{11,6,127,0,},//25
+{12,10,127,0,},//26
+{1,1,127,255,},//27
+{6,9,127,0,},//28
+{1,14,127,0,},//29
+{1,15,32,0,},//30
+{15,15,127,0}};//31
+
+/*The morphing waveshapes, MORPH_1 to MORPH_9.*/
+const OSCILLATOR_MORPH AST_OSCILLATOR_MORPH_LUT[NUMBER_OF_MORPHS] PROGMEM =
+{
+	//source a				offset a				source b				offset b					combine						flags				shift period		period					length
+	{MORPH_SOURCE_SQUARE,	MORPH_OFFSET_INDEX,		MORPH_SOURCE_RAMP,		MORPH_OFFSET_HALF,			MORPH_COMBINE_CROSSFADE,	0,					0,					10,						256},//MORPH_1
+	{MORPH_SOURCE_TRIANGLE,	MORPH_OFFSET_NONE,		MORPH_SOURCE_RAMP,		MORPH_OFFSET_SHIFTER,		MORPH_COMBINE_CROSSFADE,	0,					PHASE_SHIFT_TIMER_2,MORPH_2_TIME_PERIOD,	256},//MORPH_2
+	{MORPH_SOURCE_TRIANGLE,	MORPH_OFFSET_NONE,		MORPH_SOURCE_RAMP,		MORPH_OFFSET_MINUS_INDEX,	MORPH_COMBINE_DIFFERENCE,	0,					0,					50,						256},//MORPH_3
+	{MORPH_SOURCE_RAMP,		MORPH_OFFSET_NONE,		MORPH_SOURCE_RAMP,		MORPH_OFFSET_MINUS_INDEX,	MORPH_COMBINE_DIFFERENCE,	MORPH_PING_PONG,	0,					250,					256},//MORPH_4
+	{MORPH_SOURCE_SIN,		MORPH_OFFSET_NONE,		MORPH_SOURCE_SQUARE,	MORPH_OFFSET_NONE,			MORPH_COMBINE_ENVELOPES,	0,					0,					10,						383},//MORPH_5
+	{MORPH_SOURCE_RAMP_SIMPLE,MORPH_OFFSET_NONE,	MORPH_SOURCE_SQUARE,	MORPH_OFFSET_NONE,			MORPH_COMBINE_ENVELOPES,	0,					0,					50,						383},//MORPH_6
+	{MORPH_SOURCE_RAMP,		MORPH_OFFSET_NONE,		MORPH_SOURCE_RAMP,		MORPH_OFFSET_MINUS_INDEX,	MORPH_COMBINE_DIFFERENCE,	MORPH_KEEP_PLACE,	0,					25,						256},//MORPH_7
+	{MORPH_SOURCE_RAMP,		MORPH_OFFSET_NONE,		MORPH_SOURCE_RAMP,		MORPH_OFFSET_MINUS_INDEX,	MORPH_COMBINE_DIFFERENCE,	0,					0,					4000,					256},//MORPH_8
+	{MORPH_SOURCE_RAMP,		MORPH_OFFSET_NONE,		MORPH_SOURCE_RAMP,		MORPH_OFFSET_MINUS_INDEX,	MORPH_COMBINE_DIFFERENCE,	0,					0,					10,						256},//MORPH_9
+};
+
+OSCILLATOR_STATE g_ast_oscillator_state[NUMBER_OF_OSCILLATORS];
+OSCILLATOR_PLAN g_ast_oscillator_plan[NUMBER_OF_OSCILLATORS];
+
+#if !ASM_KERNELS || ASM_KERNEL_CHECK
+static unsigned char oscillator_kernel_sin(OSCILLATOR_PLAN *p_plan, OSCILLATOR_STATE *p_state, unsigned int un_phase);
+static unsigned char oscillator_kernel_blend(OSCILLATOR_PLAN *p_plan, OSCILLATOR_STATE *p_state, unsigned int un_phase);
+static unsigned char oscillator_kernel_half(OSCILLATOR_PLAN *p_plan, OSCILLATOR_STATE *p_state, unsigned int un_phase);
+static unsigned char oscillator_kernel_square(OSCILLATOR_PLAN *p_plan, OSCILLATOR_STATE *p_state, unsigned int un_phase);
+#endif
+#if ASM_KERNELS
+static unsigned char oscillator_kernel_sin_asm(OSCILLATOR_PLAN *p_plan, OSCILLATOR_STATE *p_state, unsigned int un_phase);
+static unsigned char oscillator_kernel_blend_asm(OSCILLATOR_PLAN *p_plan, OSCILLATOR_STATE *p_state, unsigned int un_phase);
+static unsigned char oscillator_kernel_half_asm(OSCILLATOR_PLAN *p_plan, OSCILLATOR_STATE *p_state, unsigned int un_phase);
+static unsigned char oscillator_kernel_square_asm(OSCILLATOR_PLAN *p_plan, OSCILLATOR_STATE *p_state, unsigned int un_phase);
+
+#define OSCILLATOR_KERNEL_SIN		oscillator_kernel_sin_asm
+#define OSCILLATOR_KERNEL_BLEND		oscillator_kernel_blend_asm
+#define OSCILLATOR_KERNEL_HALF		oscillator_kernel_half_asm
+#define OSCILLATOR_KERNEL_SQUARE	oscillator_kernel_square_asm
+#else
+#define OSCILLATOR_KERNEL_SIN		oscillator_kernel_sin
+#define OSCILLATOR_KERNEL_BLEND		oscillator_kernel_blend
+#define OSCILLATOR_KERNEL_HALF		oscillator_kernel_half
+#define OSCILLATOR_KERNEL_SQUARE	oscillator_kernel_square
+#endif
+static unsigned char oscillator_kernel_raw_square(OSCILLATOR_PLAN *p_plan, OSCILLATOR_STATE *p_state, unsigned int un_phase);
+static unsigned char oscillator_morph_offset(unsigned char uc_offset, OSCILLATOR_STATE *p_state, unsigned char uc_index);
+static unsigned char oscillator_morph_source(unsigned char uc_source, unsigned char uc_offset, unsigned char uc_sample_index, unsigned char uc_row);
+static unsigned char oscillator_kernel_morph(OSCILLATOR_PLAN *p_plan, OSCILLATOR_STATE *p_state, unsigned int un_phase);
+static unsigned char oscillator_kernel_generic(OSCILLATOR_PLAN *p_plan, OSCILLATOR_STATE *p_state, unsigned int un_phase);
+
+/*
+Function: initialize_oscillators
+Takes: Nothing.
+
+Returns: Nothing.
+
+This function clears the morph state of every oscillator and seeds each noise generator differently,
+so two oscillators set to noise don't play the same noise.
+*/
+void
+initialize_oscillators(void)
+{
+	unsigned char uc_index;
+	
+	for(uc_index = 0; uc_index < NUMBER_OF_OSCILLATORS; uc_index++)
+	{
+		g_ast_oscillator_state[uc_index].uc_morph_state = 0;
+		g_ast_oscillator_state[uc_index].uc_phase_shifter = 0;
+		g_ast_oscillator_state[uc_index].uc_phase_shift_timer = 0;
+		g_ast_oscillator_state[uc_index].un_morph_index = 0;
+		g_ast_oscillator_state[uc_index].un_morph_timer = 0;
+		g_ast_oscillator_state[uc_index].un_lfsr = 0xACE1 ^ (uc_index << 4);//Never 0, or the noise would stop
+		g_ast_oscillator_plan[uc_index].uc_waveshape = OSCILLATOR_PLAN_STALE;
+	}
+}
+
+/*
+Function: oscillator_sync
+Takes: 
+OSCILLATOR_STATE *p_state - The oscillator to restart.
+unsigned char uc_waveshape - The waveshape it is playing.
+
+Returns: Nothing.
+
+This function starts an oscillator's morph over from the beginning when a new note comes in. The caller
+does this for every oscillator when it sees g_uc_oscillator_midi_sync_flag. Morphs flagged MORPH_KEEP_PLACE
+carry on from where they were.
+*/
+void
+oscillator_sync(OSCILLATOR_STATE *p_state, unsigned char uc_waveshape)
+{
+	p_state->uc_morph_state = 0;
+	p_state->un_morph_timer = 0;
+	
+	if(uc_waveshape < MORPH_1 || uc_waveshape > MORPH_9
+		|| !(pgm_read_byte(&AST_OSCILLATOR_MORPH_LUT[uc_waveshape - MORPH_1].uc_flags) & MORPH_KEEP_PLACE))
+	{
+		p_state->un_morph_index = 0;
+	}
+}
+
+/*
+Function: decode_oscillator_waveshape
+Takes: 
+g_setting *p_global_setting - The global synthesizer setting array.
+unsigned char ucwaveshape - This tells the function the setting of the oscillator pot.
+      
+Returns: Nothing.
+
+This function takes the setting of the oscillator pot knob and decodes it to set the waveshape
+for each oscillator, the oscillator mix and the oscillator sync parameters.
+*/
+void
+decode_oscillator_waveshape(volatile g_setting *p_global_setting, unsigned char ucwaveshape)
+{
+	ucwaveshape = ucwaveshape >> 3;//32 waveshapes
+	
+	p_global_setting->auc_synth_params[OSC_1_WAVESHAPE] = pgm_read_byte(&AUC_OSCILLATOR_LUT[ucwaveshape][OSCILLATOR_1]);
+	
+	if(p_global_setting->auc_parameter_source[OSC_2_WAVESHAPE] == SOURCE_AD)
+	{
+		p_global_setting->auc_synth_params[OSC_2_WAVESHAPE] = pgm_read_byte(&AUC_OSCILLATOR_LUT[ucwaveshape][OSCILLATOR_2]);
+	}
+	
+	if(p_global_setting->auc_parameter_source[OSC_MIX] == SOURCE_AD)
+	{
+		p_global_setting->auc_synth_params[OSC_MIX] = pgm_read_byte(&AUC_OSCILLATOR_LUT[ucwaveshape][OSCILLATOR_MIX]);
+	}
+	
+	if(p_global_setting->auc_parameter_source[OSC_SYNC] == SOURCE_AD)
+	{
+		p_global_setting->auc_synth_params[OSC_SYNC] = pgm_read_byte(&AUC_OSCILLATOR_LUT[ucwaveshape][OSCILLATOR_SYNC]);
+	}
+}
+
+/*
+Function: oscillator_plan_update
+Takes: 
+OSCILLATOR_PLAN *p_plan - The plan to bring up to date.
+unsigned char uc_waveshape - The waveshape the oscillator should play.
+unsigned char uc_frequency - The note whose band limited tables it should play, auc_table_note.
+unsigned char uc_morph_rate - The MORPH_RATE parameter.
+
+Returns: Nothing.
+
+This function rebuilds an oscillator's render plan if its waveshape, note or morph rate changed since the plan was built.
+It runs once per audio block, so the per sample kernels never look at the waveshape, the table modulus or
+the row addresses. The blend weights are out of 256 and reproduce the blending in oscillator() exactly:
+(a + b)/2 is (128a + 128b)/256 and (3a + b)/4 is (192a + 64b)/256. The neighbouring row is kept inside the table at the
+bottom and top notes, where oscillator() would read past the ends.
+Waveshapes without a kernel of their own fall back to calling oscillator().
+*/
+void
+oscillator_plan_update(OSCILLATOR_PLAN *p_plan, unsigned char uc_waveshape, unsigned char uc_frequency, unsigned char uc_morph_rate)
+{
+	const unsigned char *p_uc_table;
+	unsigned char uc_row,
+				  uc_neighbour_row,
+				  uc_table_modulus;
+	
+	if(p_plan->uc_waveshape == uc_waveshape && p_plan->uc_frequency == uc_frequency && p_plan->uc_morph_rate == uc_morph_rate)
+	{
+		return;
+	}
+	
+	p_plan->uc_waveshape = uc_waveshape;
+	p_plan->uc_frequency = uc_frequency;
+	p_plan->uc_morph_rate = uc_morph_rate;
+	
+	uc_row = uc_frequency >> 2;//Only 32 tables
+	uc_table_modulus = uc_frequency%4;
+	
+	/*Blend with the row below for the bottom two notes of a table, the row above for the top two.*/
+	if(uc_table_modulus < 2)
+	{
+		uc_neighbour_row = (uc_row > 0) ? uc_row - 1 : uc_row;
+	}
+	else
+	{
+		uc_neighbour_row = (uc_row < 31) ? uc_row + 1 : uc_row;
+	}
+	
+	if(uc_table_modulus == 0 || uc_table_modulus == 3)
+	{
+		p_plan->uc_weight_1 = 128;
+		p_plan->uc_weight_2 = 128;
+	}
+	else
+	{
+		p_plan->uc_weight_1 = 192;
+		p_plan->uc_weight_2 = 64;
+	}
+	
+	p_uc_table = &G_AUC_RAMP_WAVETABLE_LUT[0][0];
+	
+	switch(uc_waveshape)
+	{
+		case SIN:
+			
+			p_plan->pf_kernel = OSCILLATOR_KERNEL_SIN;
+		
+		break;
+		
+		case SQUARE:
+		
+			p_plan->pf_kernel = OSCILLATOR_KERNEL_SQUARE;
+			
+		break;
+		
+		case TRIANGLE:
+		
+			p_uc_table = &G_AUC_TRIANGLE_WAVETABLE_LUT[0][0];
+			p_plan->pf_kernel = OSCILLATOR_KERNEL_HALF;
+			
+		break;
+		
+		case RAMP:
+		
+			p_plan->pf_kernel = OSCILLATOR_KERNEL_HALF;
+			
+		break;
+		
+		case RAW_SQUARE:
+		
+			p_plan->pf_kernel = oscillator_kernel_raw_square;
+			
+		break;
+		
+		case WAVETABLE_SCAN:
+		
+			//The rows and weights follow SCAN_POSITION, oscillator_plan_scan() sets them every block
+			p_uc_table = &G_AUC_SCAN_WAVETABLE_LUT[0][0];
+			uc_row = 0;
+			uc_neighbour_row = 0;
+			p_plan->pf_kernel = OSCILLATOR_KERNEL_BLEND;
+			
+		break;
+		
+		case MORPH_1:
+		case MORPH_2:
+		case MORPH_3:
+		case MORPH_4:
+		case MORPH_5:
+		case MORPH_6:
+		case MORPH_7:
+		case MORPH_8:
+		case MORPH_9:
+		
+			oscillator_morph_load(&p_plan->st_morph, uc_waveshape, uc_morph_rate);
+			p_plan->pf_kernel = oscillator_kernel_morph;
+			
+		break;
+		
+		default:
+		
+			p_plan->pf_kernel = oscillator_kernel_generic;
+		
+		break;
+	}
+	
+	p_plan->p_uc_row_1 = p_uc_table + uc_row * WAVETABLE_HALF_SIZE;
+	p_plan->p_uc_row_2 = p_uc_table + uc_neighbour_row * WAVETABLE_HALF_SIZE;
+}
+
+/*
+Function: oscillator_plan_scan
+Takes: 
+OSCILLATOR_PLAN *p_plan - A WAVETABLE_SCAN plan.
+unsigned char uc_position - Where in the bank, 0 for the first frame, 255 for the last.
+
+Returns: Nothing.
+
+This function points a scanning plan at the two frames either side of the position, with the crossfade between
+them as its blend weights. It runs once per block, so the per sample work is the blend kernel: two reads from
+flash and two multiplies. The frames aren't symmetric, so they are stored whole, unlike the ramps. Sitting right on a frame, both rows are that frame at half weight,
+since a weight of 256 doesn't fit in a byte.
+*/
+void
+oscillator_plan_scan(OSCILLATOR_PLAN *p_plan, unsigned char uc_position)
+{
+	unsigned int un_scan;
+	unsigned char uc_fade;
+	
+	//position * 15 * 256/255, so every 17 steps of position lands right on a frame and 255 on the last one
+	un_scan = uc_position * (WAVETABLE_SCAN_FRAMES - 1);
+	un_scan += (un_scan + 128) >> 8;
+	uc_fade = un_scan;
+	
+	p_plan->p_uc_row_1 = &G_AUC_SCAN_WAVETABLE_LUT[un_scan >> 8][0];
+	
+	if(uc_fade == 0)
+	{
+		p_plan->p_uc_row_2 = p_plan->p_uc_row_1;
+		p_plan->uc_weight_1 = 128;
+		p_plan->uc_weight_2 = 128;
+	}
+	else
+	{
+		p_plan->p_uc_row_2 = p_plan->p_uc_row_1 + 256;
+		p_plan->uc_weight_1 = 256 - uc_fade;
+		p_plan->uc_weight_2 = uc_fade;
+	}
+}
+
+/*
+Function: oscillator_scan_position
+Takes: 
+g_setting *p_global_setting - The global setting structure.
+
+Returns: unsigned char - The scanning position to play, 0 to 255.
+
+This function works out the scanning position: SCAN_POSITION, which the LFO may be moving, pushed up by the
+amplitude envelope times SCAN_ENV_AMOUNT.
+*/
+unsigned char
+oscillator_scan_position(g_setting *p_global_setting)
+{
+	unsigned int un_position;
+	unsigned char uc_envelope;
+	
+	uc_envelope = p_global_setting->uc_adsr_multiplier;
+	uc_envelope = (uc_envelope > ADSR_MIN_VALUE) ? uc_envelope - ADSR_MIN_VALUE : 0;
+	
+	un_position = p_global_setting->auc_synth_params[SCAN_POSITION];
+	un_position += (uc_envelope * p_global_setting->auc_synth_params[SCAN_ENV_AMOUNT]) >> 8;
+	
+	return (un_position > 255) ? 255 : un_position;
+}
+
+/*
+The render plan kernels. Each one gives the same sample as the matching case in oscillator(), with everything
+that depends only on the note already worked out in the plan. They take the full 16 bit phase.
+The C versions of sin, blend, half and square are the reference for the assembly versions further down.
+*/
+#if !ASM_KERNELS || ASM_KERNEL_CHECK
+static unsigned char
+oscillator_kernel_sin(OSCILLATOR_PLAN *p_plan, OSCILLATOR_STATE *p_state, unsigned int un_phase)
+{
+	unsigned char uc_temp;
+	
+	uc_temp = un_phase >> 8;
+	
+	return linear_interpolate((un_phase >> 1) & 0x7F, wavetable_sin(uc_temp), wavetable_sin((unsigned char)(uc_temp + 1)));
+}
+
+static unsigned char
+oscillator_kernel_blend(OSCILLATOR_PLAN *p_plan, OSCILLATOR_STATE *p_state, unsigned int un_phase)
+{
+	unsigned char uc_sample_index;
+	unsigned int un_sample_calc;
+	
+	uc_sample_index = un_phase >> 8;//shift from 65536 to 256
+	
+	un_sample_calc = pgm_read_byte(p_plan->p_uc_row_1 + uc_sample_index) * p_plan->uc_weight_1;
+	un_sample_calc += pgm_read_byte(p_plan->p_uc_row_2 + uc_sample_index) * p_plan->uc_weight_2;
+	
+	return un_sample_calc >> 8;
+}
+
+static unsigned char
+oscillator_kernel_half(OSCILLATOR_PLAN *p_plan, OSCILLATOR_STATE *p_state, unsigned int un_phase)
+{
+	unsigned char uc_sample_index;
+	unsigned int un_sample_calc;
+	
+	uc_sample_index = un_phase >> 8;//shift from 65536 to 256
+	
+	/*The blend on rows stored as half cycles*/
+	un_sample_calc = wavetable_half(p_plan->p_uc_row_1, uc_sample_index) * p_plan->uc_weight_1;
+	un_sample_calc += wavetable_half(p_plan->p_uc_row_2, uc_sample_index) * p_plan->uc_weight_2;
+	
+	return un_sample_calc >> 8;
+}
+
+static unsigned char
+oscillator_kernel_square(OSCILLATOR_PLAN *p_plan, OSCILLATOR_STATE *p_state, unsigned int un_phase)
+{
+	unsigned char uc_sample_index;
+	signed int sn_temp;
+	
+	uc_sample_index = un_phase >> 8;//shift from 65536 to 256
+	
+	/*Same as calculate_square() with a pulse width of 127, on the row already picked out.*/
+	sn_temp = wavetable_half(p_plan->p_uc_row_1, uc_sample_index);
+	uc_sample_index -= 127;
+	sn_temp -= wavetable_half(p_plan->p_uc_row_1, uc_sample_index);
+	
+	if(sn_temp > 127)
+	{
+		return 255;
+	}
+	else if(sn_temp < -128)
+	{
+		return 0;
+	}
+	
+	return 128 + sn_temp;
+}
+#endif
+
+static unsigned char
+oscillator_kernel_raw_square(OSCILLATOR_PLAN *p_plan, OSCILLATOR_STATE *p_state, unsigned int un_phase)
+{
+	return ((un_phase >> 1) > HALF_SAMPLE_MAX) ? 255 : 0;
+}
+
+static unsigned char
+oscillator_kernel_morph(OSCILLATOR_PLAN *p_plan, OSCILLATOR_STATE *p_state, unsigned int un_phase)
+{
+	return oscillator_morph(&p_plan->st_morph, p_state, un_phase >> 8, p_plan->uc_frequency >> 2);
+}
+
+static unsigned char
+oscillator_kernel_generic(OSCILLATOR_PLAN *p_plan, OSCILLATOR_STATE *p_state, unsigned int un_phase)
+{
+	return oscillator(p_state, p_plan->uc_waveshape, un_phase, p_plan->uc_frequency);
+}
+
+#if ASM_KERNELS
+/*
+The assembly kernels. Each one gives exactly the same sample as the C version of the same name above, using the
+8x8 MUL and the carry flag where the C works in 16 bit ints. Cycles inside the kernel, not counting the call through
+pf_kernel or loading the plan fields. The assembly cycles are counted by tools/asm_kernel_model.py. The C ones are
+estimated from what avr-gcc -Os makes of the C reference, not measured. Set ASM_KERNEL_CHECK to check the assembly
+against the C and time both on the chip.
+
+	Kernel			C			Assembly cycles
+	sin				about 65	42 to 45, folding both samples out of the quarter wave, the C calls linear_interpolate()
+	blend			about 22	20, for the scanning frames
+	half			33 to 37	27 to 29, the blend on half cycle rows
+	square			36 to 42	25 to 30, both samples out of the half cycle row, 20 to 22 on whole rows
+	mix/filter		35 to 40	21 to 23 with the sub oscillator (audio_block.c)
+	phase mod		about 9		6, the multiply-add onto OSC_2's phase (audio_block.c)
+	unison			52n + 14	42n + 8 for n voices (audio_block.c)
+*/
+static unsigned char
+oscillator_kernel_sin_asm(OSCILLATOR_PLAN *p_plan, OSCILLATOR_STATE *p_state, unsigned int un_phase)
+{
+	unsigned char	uc_result,
+					uc_sample_2,
+					uc_index,
+					uc_next;
+	unsigned int un_address;
+	
+	/*Each sample is folded out of the quarter wave the way wavetable_quarter() does it: (index + 1) & 0x7F, mirrored
+	down if it's over 64, and turned over with COM if the index is in the second half. 128 - n is -n - 128.
+	Going down, floor() of the negative difference is the same as taking away the rounded up product.
+	neg r0 sets the carry if there's anything below the top byte, and sbc takes away that extra 1.*/
+	__asm__ (
+		"mov %[index], %B[phase]"				"\n\t"	//sample 1 = wavetable_sin(phase >> 8)
+		"subi %[index], -1"						"\n\t"
+		"andi %[index], 0x7F"					"\n\t"
+		"cpi %[index], 65"						"\n\t"
+		"brlo 1f"								"\n\t"
+		"neg %[index]"							"\n\t"
+		"subi %[index], 0x80"					"\n\t"
+	"1:	ldi %A[address], lo8(%[lut])"			"\n\t"
+		"ldi %B[address], hi8(%[lut])"			"\n\t"
+		"add %A[address], %[index]"				"\n\t"
+		"adc %B[address], __zero_reg__"			"\n\t"
+		"lpm %[result], %a[address]"			"\n\t"
+		"sbrc %B[phase], 7"						"\n\t"
+		"com %[result]"							"\n\t"
+		"mov %[next], %B[phase]"				"\n\t"	//sample 2 = wavetable_sin((phase >> 8) + 1)
+		"subi %[next], -1"						"\n\t"
+		"mov %[index], %[next]"					"\n\t"
+		"subi %[index], -1"						"\n\t"
+		"andi %[index], 0x7F"					"\n\t"
+		"cpi %[index], 65"						"\n\t"
+		"brlo 2f"								"\n\t"
+		"neg %[index]"							"\n\t"
+		"subi %[index], 0x80"					"\n\t"
+	"2:	ldi %A[address], lo8(%[lut])"			"\n\t"
+		"ldi %B[address], hi8(%[lut])"			"\n\t"
+		"add %A[address], %[index]"				"\n\t"
+		"adc %B[address], __zero_reg__"			"\n\t"
+		"lpm %[sample_2], %a[address]"			"\n\t"
+		"sbrc %[next], 7"						"\n\t"
+		"com %[sample_2]"						"\n\t"
+		"mov %[index], %A[phase]"				"\n\t"	//fraction = (phase >> 1) & 0x7F
+		"lsr %[index]"							"\n\t"
+		"sub %[sample_2], %[result]"			"\n\t"	//sample 2 - sample 1, the borrow says which way it goes
+		"brcs 3f"								"\n\t"
+		"mul %[sample_2], %[index]"				"\n\t"	//Going up, add the top byte of difference * fraction
+		"add %[result], r1"						"\n\t"
+		"rjmp 4f"								"\n\t"
+	"3:	neg %[sample_2]"						"\n\t"	//Going down, take away the top byte, rounded up
+		"mul %[sample_2], %[index]"				"\n\t"
+		"neg r0"								"\n\t"
+		"sbc %[result], r1"						"\n\t"
+	"4:	clr __zero_reg__"						"\n\t"
+		: [result] "=&r" (uc_result),
+		  [sample_2] "=&r" (uc_sample_2),
+		  [index] "=&d" (uc_index),
+		  [next] "=&d" (uc_next),
+		  [address] "=&z" (un_address)
+		: [phase] "r" (un_phase),
+		  [lut] "i" (G_AUC_SIN_QUARTER_LUT)
+	);
+	
+	return uc_result;
+}
+
+static unsigned char
+oscillator_kernel_blend_asm(OSCILLATOR_PLAN *p_plan, OSCILLATOR_STATE *p_state, unsigned int un_phase)
+{
+	unsigned char	uc_sample_1,
+					uc_sample_2;
+	unsigned int	un_address,
+					un_sample_calc;
+	
+	__asm__ (
+		"movw %[address], %[row_1]"				"\n\t"	//Z = row 1 + (phase >> 8)
+		"add %A[address], %B[phase]"			"\n\t"
+		"adc %B[address], __zero_reg__"			"\n\t"
+		"lpm %[sample_1], %a[address]"			"\n\t"
+		"movw %[address], %[row_2]"				"\n\t"	//Z = row 2 + (phase >> 8)
+		"add %A[address], %B[phase]"			"\n\t"
+		"adc %B[address], __zero_reg__"			"\n\t"
+		"lpm %[sample_2], %a[address]"			"\n\t"
+		"mul %[sample_1], %[weight_1]"			"\n\t"	//sample 1 * weight 1 + sample 2 * weight 2
+		"movw %[calc], r0"						"\n\t"
+		"mul %[sample_2], %[weight_2]"			"\n\t"
+		"add %A[calc], r0"						"\n\t"
+		"adc %B[calc], r1"						"\n\t"	//the top byte is the sample
+		"clr __zero_reg__"						"\n\t"
+		: [calc] "=&r" (un_sample_calc),
+		  [sample_1] "=&r" (uc_sample_1),
+		  [sample_2] "=&r" (uc_sample_2),
+		  [address] "=&z" (un_address)
+		: [phase] "r" (un_phase),
+		  [row_1] "r" (p_plan->p_uc_row_1),
+		  [row_2] "r" (p_plan->p_uc_row_2),
+		  [weight_1] "r" (p_plan->uc_weight_1),
+		  [weight_2] "r" (p_plan->uc_weight_2)
+	);
+	
+	return un_sample_calc >> 8;
+}
+
+static unsigned char
+oscillator_kernel_half_asm(OSCILLATOR_PLAN *p_plan, OSCILLATOR_STATE *p_state, unsigned int un_phase)
+{
+	unsigned char	uc_sample_1,
+					uc_sample_2,
+					uc_index;
+	unsigned int	un_address,
+					un_sample_calc;
+	
+	/*Both rows are read at the same entry, (phase >> 8) + 1, negated in the second half as in wavetable_half().
+	Rather than turn both samples over in the second half, the blend is turned over once: with the weights adding
+	up to 256, (w1(255 - a) + w2(255 - b)) >> 8 is 255 - ((w1a + w2b + 255) >> 8). Adding 255 is taking away 0xFF01.*/
+	__asm__ (
+		"mov %[index], %B[phase]"				"\n\t"	//index = (phase >> 8) + 1, negated in the second half
+		"subi %[index], -1"						"\n\t"
+		"sbrc %B[phase], 7"						"\n\t"
+		"neg %[index]"							"\n\t"
+		"movw %[address], %[row_1]"				"\n\t"	//Z = row 1 + index
+		"add %A[address], %[index]"				"\n\t"
+		"adc %B[address], __zero_reg__"			"\n\t"
+		"lpm %[sample_1], %a[address]"			"\n\t"
+		"movw %[address], %[row_2]"				"\n\t"	//Z = row 2 + index
+		"add %A[address], %[index]"				"\n\t"
+		"adc %B[address], __zero_reg__"			"\n\t"
+		"lpm %[sample_2], %a[address]"			"\n\t"
+		"mul %[sample_1], %[weight_1]"			"\n\t"	//sample 1 * weight 1 + sample 2 * weight 2
+		"movw %[calc], r0"						"\n\t"
+		"mul %[sample_2], %[weight_2]"			"\n\t"
+		"add %A[calc], r0"						"\n\t"
+		"adc %B[calc], r1"						"\n\t"
+		"clr __zero_reg__"						"\n\t"
+		"sbrs %B[phase], 7"						"\n\t"
+		"rjmp 1f"								"\n\t"
+		"subi %A[calc], 0x01"					"\n\t"	//second half, the top byte of 255 - (calc + 255)
+		"sbci %B[calc], 0xFF"					"\n\t"
+		"com %B[calc]"							"\n\t"
+	"1:"										"\n\t"
+		: [calc] "=&d" (un_sample_calc),
+		  [sample_1] "=&r" (uc_sample_1),
+		  [sample_2] "=&r" (uc_sample_2),
+		  [index] "=&d" (uc_index),
+		  [address] "=&z" (un_address)
+		: [phase] "r" (un_phase),
+		  [row_1] "r" (p_plan->p_uc_row_1),
+		  [row_2] "r" (p_plan->p_uc_row_2),
+		  [weight_1] "r" (p_plan->uc_weight_1),
+		  [weight_2] "r" (p_plan->uc_weight_2)
+	);
+	
+	return un_sample_calc >> 8;
+}
+
+static unsigned char
+oscillator_kernel_square_asm(OSCILLATOR_PLAN *p_plan, OSCILLATOR_STATE *p_state, unsigned int un_phase)
+{
+	unsigned char	uc_result,
+					uc_sample,
+					uc_index,
+					uc_other;
+	unsigned int un_address;
+	
+	/*Both samples come out of the half cycle row as in wavetable_half(). Being half a cycle apart they fall in
+	opposite halves of the row, so the index is folded once, m = ((phase >> 8) + 1) & 0x7F, and the two entries
+	are m and 127 - m, each one further on in the second half. One of the two is turned over, so the difference is
+	a + b - 255 in the first half and 255 - (a + b) in the second, and 128 + that is clipped from the 9 bit sum.
+	Phases 127 and 255 have both samples in the same half, entries 128 and 1 or 127 and 0, and take a - b.
+	That's 5 to 8 cycles more than on whole rows: 3 for the fold, and the halves clip a sum that's turned the
+	other way round, so each needs its own add and clip. tools/asm_kernel_model.py counts them.*/
+	__asm__ (
+		"mov %[index], %B[phase]"				"\n\t"	//m = ((phase >> 8) + 1) & 0x7F
+		"subi %[index], -1"						"\n\t"
+		"andi %[index], 0x7F"					"\n\t"
+		"movw %[address], %[row]"				"\n\t"
+		"breq 5f"								"\n\t"	//phase >> 8 is 127 or 255
+		"sbrc %B[phase], 7"						"\n\t"
+		"rjmp 2f"								"\n\t"
+		"ldi %[other], 127"						"\n\t"	//first half, entries m and 127 - m
+		"sub %[other], %[index]"				"\n\t"
+		"add %A[address], %[index]"				"\n\t"
+		"adc %B[address], __zero_reg__"			"\n\t"
+		"lpm %[result], %a[address]"			"\n\t"
+		"movw %[address], %[row]"				"\n\t"
+		"add %A[address], %[other]"				"\n\t"
+		"adc %B[address], __zero_reg__"			"\n\t"
+		"lpm %[sample], %a[address]"			"\n\t"
+	"1:	add %[result], %[sample]"				"\n\t"	//128 + a + b - 255
+		"brcs 3f"								"\n\t"
+		"subi %[result], 127"					"\n\t"
+		"brcc 9f"								"\n\t"
+		"ldi %[result], 0"						"\n\t"	//under -128, clip at the bottom
+		"rjmp 9f"								"\n\t"
+	"3:	subi %[result], 127"					"\n\t"
+		"brcs 9f"								"\n\t"
+		"ldi %[result], 255"					"\n\t"	//over 127, clip at the top
+		"rjmp 9f"								"\n\t"
+	"2:	ldi %[other], 128"						"\n\t"	//second half, entries m + 1 and 128 - m
+		"sub %[other], %[index]"				"\n\t"
+		"inc %[index]"							"\n\t"
+		"add %A[address], %[index]"				"\n\t"
+		"adc %B[address], __zero_reg__"			"\n\t"
+		"lpm %[result], %a[address]"			"\n\t"
+		"movw %[address], %[row]"				"\n\t"
+		"add %A[address], %[other]"				"\n\t"
+		"adc %B[address], __zero_reg__"			"\n\t"
+		"lpm %[sample], %a[address]"			"\n\t"
+		"add %[result], %[sample]"				"\n\t"	//128 + 255 - (a + b), the low byte turned over less 128
+		"brcs 4f"								"\n\t"
+		"subi %[result], 128"					"\n\t"
+		"brcs 6f"								"\n\t"
+		"com %[result]"							"\n\t"
+		"rjmp 9f"								"\n\t"
+	"5:	subi %A[address], 0x81"					"\n\t"	//phase 127, entries 128 and 1, or 255, entries 127 and 0
+		"sbci %B[address], 0xFF"				"\n\t"
+		"sbrs %B[phase], 7"						"\n\t"
+		"adiw %[address], 1"					"\n\t"
+		"lpm %[result], %a[address]"			"\n\t"
+		"subi %A[address], 127"					"\n\t"
+		"sbci %B[address], 0"					"\n\t"
+		"lpm %[sample], %a[address]"			"\n\t"
+		"com %[sample]"							"\n\t"	//a + (255 - b) - 255
+		"rjmp 1b"								"\n\t"
+	"6:	ldi %[result], 255"						"\n\t"	//over 127, clip at the top
+		"rjmp 9f"								"\n\t"
+	"4:	subi %[result], 128"					"\n\t"
+		"brcc 7f"								"\n\t"
+		"com %[result]"							"\n\t"
+		"rjmp 9f"								"\n\t"
+	"7:	ldi %[result], 0"						"\n\t"	//under -128, clip at the bottom
+	"9:"										"\n\t"
+		: [result] "=&d" (uc_result),
+		  [sample] "=&r" (uc_sample),
+		  [index] "=&d" (uc_index),
+		  [other] "=&d" (uc_other),
+		  [address] "=&z" (un_address)
+		: [phase] "r" (un_phase),
+		  [row] "r" (p_plan->p_uc_row_1)
+	);
+	
+	return uc_result;
+}
+#endif
+
+#if ASM_KERNELS && ASM_KERNEL_CHECK
+/*
+@brief This function runs the sin, blend, half and square assembly kernels against their C versions at every phase
+that makes a difference to them, for every note, and keeps the worst case cycles of each. The results end up
+in g_un_asm_kernel_mismatch_count, which should be 0, and g_auc_asm_kernel_cycles. It takes about a second
+and has to run with interrupts off.
+
+@param It takes no parameters.
+
+@return It doesn't return anything.
+*/
+void
+oscillator_kernel_check(void)
+{
+	OSCILLATOR_PLAN st_plan;
+	unsigned char (*pf_reference)(OSCILLATOR_PLAN *p_plan, OSCILLATOR_STATE *p_state, unsigned int un_phase);
+	
+	unsigned char	uc_check,
+					uc_waveshape,
+					uc_note,
+					uc_kernel,
+					uc_reference,
+					uc_result,
+					uc_cycles;
+					
+	unsigned int	un_phase,
+					un_phase_step;
+	
+	for(uc_check = SIN; uc_check <= TRIANGLE + 1; uc_check++)
+	{
+		//SIN to TRIANGLE, then the scanning frames at 128 positions
+		uc_waveshape = (uc_check <= TRIANGLE) ? uc_check : WAVETABLE_SCAN;
+		
+		switch(uc_waveshape)
+		{
+			case SIN:
+			
+				pf_reference = oscillator_kernel_sin;
+				uc_kernel = ASM_KERNEL_SIN;
+				un_phase_step = 2;//Sin looks at the top 15 bits of the phase
+				
+			break;
+			
+			case SQUARE:
+			
+				pf_reference = oscillator_kernel_square;
+				uc_kernel = ASM_KERNEL_SQUARE;
+				un_phase_step = 256;//The wavetables only look at the top byte
+				
+			break;
+			
+			case WAVETABLE_SCAN:
+			
+				pf_reference = oscillator_kernel_blend;
+				uc_kernel = ASM_KERNEL_BLEND;
+				un_phase_step = 256;
+				
+			break;
+			
+			default:
+			
+				pf_reference = oscillator_kernel_half;
+				uc_kernel = ASM_KERNEL_HALF;
+				un_phase_step = 256;
+				
+			break;
+		}
+		
+		for(uc_note = 0; uc_note < 128; uc_note++)
+		{
+			st_plan.uc_waveshape = OSCILLATOR_PLAN_STALE;
+			oscillator_plan_update(&st_plan, uc_waveshape, uc_note, 0);
+			
+			if(WAVETABLE_SCAN == uc_waveshape)
+			{
+				oscillator_plan_scan(&st_plan, uc_note << 1);//The note is the scanning position here
+			}
+			
+			un_phase = 0;
+			
+			do
+			{
+				ASM_KERNEL_CYCLES(uc_cycles, uc_reference = pf_reference(&st_plan, &g_ast_oscillator_state[OSC_1], un_phase));
+				
+				if(uc_cycles > g_auc_asm_kernel_cycles[uc_kernel][0])
+				{
+					g_auc_asm_kernel_cycles[uc_kernel][0] = uc_cycles;
+				}
+				
+				ASM_KERNEL_CYCLES(uc_cycles, uc_result = st_plan.pf_kernel(&st_plan, &g_ast_oscillator_state[OSC_1], un_phase));
+				
+				if(uc_cycles > g_auc_asm_kernel_cycles[uc_kernel][1])
+				{
+					g_auc_asm_kernel_cycles[uc_kernel][1] = uc_cycles;
+				}
+				
+				if(uc_result != uc_reference)
+				{
+					g_un_asm_kernel_mismatch_count++;
+				}
+				
+				un_phase += un_phase_step;
+				
+			}while(un_phase != 0);
+			
+			if(SIN == uc_waveshape)
+			{
+				break;//The sin table is the same for every note
+			}
+		}
+	}
+}
+#endif
+
+/*
+Function: oscillator
+Takes: OSCILLATOR_STATE *p_state - The morph timers and noise generator belonging to this oscillator
+       unsigned char ucwaveshape - This tells the function which waveshape to generate
+       unsigned int unsample_reference - This tells the function where we are in the wave cycle, 0 to 65535
+
+Returns: unsigned char - An eight bit unsigned sample value.
+
+This function takes a waveshape variable, a sample reference (where we are in the cycle), and a frequency 
+and returns an appropriate 8 bit value for that point in the cycle.  It may take a wavetable directly, or 
+add some together or some other math function to make some new time-varying waveshape.
+
+*/
+unsigned char 
+oscillator(OSCILLATOR_STATE *p_state, unsigned char uc_waveshape, unsigned int un_sample_reference, unsigned char uc_frequency){
+	
+	unsigned char	uc_temp,
+					uc_interpolate_sample_1,
+					uc_interpolate_sample_2,
+					uc_interpolate_reference,
+					uc_sample = 0,
+					lfsr_bit,
+					uc_sample_index,
+					uc_table_modulus;
+					
+	unsigned int	un_sample_calc = 0;
+	
+	OSCILLATOR_MORPH st_morph;
+	OSCILLATOR_PLAN st_plan;
+					
+	//The waveshapes below were written for a 15 bit sample reference (0 to SAMPLE_MAX), drop the extra bit.
+	un_sample_reference >>= 1;
+	
+	/*Some of the code in this file has not been space optimized. I did this to make it easier for me to develop. Work
+	can be done to decrease the size of this code by creating functions to handle wavetable blending.*/
+
+	/*The morphs run on timers in *p_state, so two oscillators morphing at once don't speed each other up.*/
+
+
+	/*Wavetable Blending Explained:
+	A bunch of the wavetables below have blending going on. Rather than explain it every time. Here's
+	what's going on.
+	The wavetables are set up with 32 tables for 128 notes, that is 4 notes per table.
+	In order to smooth the transition from table to table, we need to blend the tables together.
+	We make a weighted average of 4 samples. 
+	1st note = half current table + half table below/2
+	2nd note = 3* current table + 1 from table below /4
+	3rd note = 3* current table + 1 from table above
+	4th note = half current table + half from table above /2
+	Not so hard, n'est-ce pas?
+	*/
+					
+	//switch statment for different waveshapes
+	switch(uc_waveshape)
+	{
+		//Sin values are in a lookup table generated by calculating one cycle of a sine wave 
+		case SIN:
+			
+			uc_temp = un_sample_reference >> 7;
+			
+			//To interpolate, we need the remainder which is what's discarded above.
+			uc_interpolate_reference = un_sample_reference & 0x7F;
+			
+			//We need the first sample.
+			uc_interpolate_sample_1 = wavetable_sin(uc_temp);
+
+			//We need to get the next sample.
+			uc_temp++;
+
+			uc_interpolate_sample_2 = wavetable_sin(uc_temp);
+						
+			uc_sample = linear_interpolate(uc_interpolate_reference, uc_interpolate_sample_1, uc_interpolate_sample_2);
+		
+		break;
+
+		case SQUARE:
+	
+			uc_frequency >>= 2;//Only 32 tables
+			uc_sample_index = un_sample_reference>>7;//shift from 32768 to 256
+			
+			uc_sample = calculate_square(uc_sample_index,uc_frequency,127);
+			
+		break;
+							
+		case RAMP:
+			
+			uc_table_modulus = uc_frequency%4;
+			uc_frequency >>= 2;//Only 32 tables
+			uc_sample_index = un_sample_reference>>7;//shift from 32768 to 256
+			
+			/*This operation blends wavetables to minimize moving aliasing as the keyboard is played*/
+			switch(uc_table_modulus)
+			{
+				case 0:
+
+					un_sample_calc = wavetable_ramp(uc_frequency, uc_sample_index);
+					uc_frequency--;
+					un_sample_calc += wavetable_ramp(uc_frequency, uc_sample_index);
+					un_sample_calc >>= 1;
+
+				break;
+
+				case 1:
+
+					un_sample_calc = wavetable_ramp(uc_frequency, uc_sample_index);
+					un_sample_calc *= 3;
+					uc_frequency--;
+					un_sample_calc += wavetable_ramp(uc_frequency, uc_sample_index);
+					un_sample_calc >>= 2;
+
+				break;
+
+				case 2:
+
+					un_sample_calc = wavetable_ramp(uc_frequency, uc_sample_index);
+					un_sample_calc *= 3;
+					uc_frequency++;
+					un_sample_calc += wavetable_ramp(uc_frequency, uc_sample_index);
+					un_sample_calc >>= 2;
+
+				break;
+
+				case 3:
+					un_sample_calc = wavetable_ramp(uc_frequency, uc_sample_index);
+					uc_frequency++;
+					un_sample_calc += wavetable_ramp(uc_frequency, uc_sample_index);
+					un_sample_calc >>= 1;
+
+				break;
+
+				default:
+				
+					un_sample_calc = 0;
+
+				break;
+
+			}
+			
+			uc_sample = (unsigned char) un_sample_calc;		
+		
+		break;
+
+						
+		case TRIANGLE:
+
+			uc_table_modulus = uc_frequency%4;
+			uc_frequency >>= 2;//Only 32 tables
+			uc_sample_index = un_sample_reference>>7;//shift from 32768 to 256
+			
+			/*This operation blends wavetables to minimize moving aliasing as the keyboard is played*/
+			switch(uc_table_modulus)
+			{
+				case 0:
+
+					un_sample_calc = wavetable_triangle(uc_frequency, uc_sample_index);
+					uc_frequency--;
+					un_sample_calc += wavetable_triangle(uc_frequency, uc_sample_index);
+					un_sample_calc >>= 1;
+
+				break;
+
+				case 1:
+
+					un_sample_calc = wavetable_triangle(uc_frequency, uc_sample_index);
+					un_sample_calc *= 3;
+					uc_frequency--;
+					un_sample_calc += wavetable_triangle(uc_frequency, uc_sample_index);
+					un_sample_calc >>= 2;
+
+				break;
+
+				case 2:
+
+					un_sample_calc = wavetable_triangle(uc_frequency, uc_sample_index);
+					un_sample_calc *= 3;
+					uc_frequency++;
+					un_sample_calc += wavetable_triangle(uc_frequency, uc_sample_index);
+					un_sample_calc >>= 2;
+
+				break;
+
+				case 3:
+					un_sample_calc = wavetable_triangle(uc_frequency, uc_sample_index);
+					uc_frequency++;
+					un_sample_calc += wavetable_triangle(uc_frequency, uc_sample_index);
+					un_sample_calc >>= 1;
+
+				break;
+
+				default:
+				
+					un_sample_calc = 0;
+
+				break;
+
+			}
+			
+			uc_sample = (unsigned char) un_sample_calc;	
+				
+		break;
+					
+
+		case MORPH_1:
+		case MORPH_2:
+		case MORPH_3:
+		case MORPH_4:
+		case MORPH_5:
+		case MORPH_6:
+		case MORPH_7:
+		case MORPH_8:
+		case MORPH_9:
+		
+			/*The morphs are rows in AST_OSCILLATOR_MORPH_LUT. The render plans keep their row in RAM,
+			here it has to come out of flash every sample.*/
+			oscillator_morph_load(&st_morph, uc_waveshape, p_global_setting->auc_synth_params[MORPH_RATE]);
+			uc_sample = oscillator_morph(&st_morph, p_state, un_sample_reference >> 7, uc_frequency >> 2);
+			
+		break;
+		
+		case WAVETABLE_SCAN:
+		
+			//Works out the frames and crossfade every sample, where the render plans do it once a block
+			oscillator_plan_scan(&st_plan, oscillator_scan_position(p_global_setting));
+			uc_sample = OSCILLATOR_KERNEL_BLEND(&st_plan, p_state, un_sample_reference << 1);
+			
+		break;
+
+		case NOISE:
+
+			/*A pseudo random number is generated using a linear feedback shift register
+			The polynomial expression used is: x^16 + x^14 + x^13 + x^11 + 1*/
+
+			lfsr_bit = ((p_state->un_lfsr >> 15) ^ (p_state->un_lfsr >> 13) ^ (p_state->un_lfsr ^ 12) ^ (p_state->un_lfsr >> 10)) & 1;
+			p_state->un_lfsr = (p_state->un_lfsr << 1) | (lfsr_bit); 
+        
+			uc_sample = (unsigned char) p_state->un_lfsr;
+
+		break;
+		
+		case RAW_SQUARE:
+
+			if(un_sample_reference > HALF_SAMPLE_MAX)
+			{
+				uc_sample = 255;
+			}
+			else
+			{
+				uc_sample = 0;
+			}
+
+		break;
+
+
+		default:
+
+			uc_temp = un_sample_reference >> 7;				
+			uc_sample = wavetable_sin(uc_temp);
+		
+		break;
+
+	}
+
+ 	return uc_sample;
+				
+}
+
+
+/*
+Function: oscillator_morph_load
+Takes: 
+OSCILLATOR_MORPH *p_morph - Where to put the morph.
+unsigned char uc_waveshape - MORPH_1 to MORPH_9.
+unsigned char uc_morph_rate - The MORPH_RATE parameter.
+
+Returns: Nothing.
+
+This function copies a morph's row out of AST_OSCILLATOR_MORPH_LUT and scales its periods by the morph rate.
+A rate of 0 leaves them as they are and every step up takes 1/256 off, down to a period of 1 sample.
+*/
+void
+oscillator_morph_load(OSCILLATOR_MORPH *p_morph, unsigned char uc_waveshape, unsigned char uc_morph_rate)
+{
+	unsigned int un_scale;
+	
+	memcpy_P(p_morph, &AST_OSCILLATOR_MORPH_LUT[uc_waveshape - MORPH_1], sizeof(OSCILLATOR_MORPH));
+	
+	if(uc_morph_rate != 0)
+	{
+		un_scale = 256 - uc_morph_rate;
+		
+		p_morph->un_period = ((unsigned long)p_morph->un_period * un_scale) >> 8;
+		
+		if(p_morph->un_period == 0)
+		{
+			p_morph->un_period = 1;
+		}
+		
+		//0 means no phase shifter, so one that's there never scales below 1
+		if(p_morph->uc_shift_period != 0)
+		{
+			p_morph->uc_shift_period = (p_morph->uc_shift_period * un_scale) >> 8;
+			
+			if(p_morph->uc_shift_period == 0)
+			{
+				p_morph->uc_shift_period = 1;
+			}
+		}
+	}
+}
+
+/*
+Function: oscillator_morph
+Takes: 
+OSCILLATOR_MORPH *p_morph - The morph to play, from oscillator_morph_load().
+OSCILLATOR_STATE *p_state - The morph index and timers belonging to this oscillator.
+unsigned char uc_sample_index - Where we are in the cycle, 0 to 255.
+unsigned char uc_row - Which of the 32 wavetable rows the note uses.
+
+Returns: unsigned char - An eight bit unsigned sample value.
+
+This function moves the morph along one sample and works out the sample. Every morph goes the same way:
+step the index, fetch a sample from each source at its offset, combine the two.
+*/
+unsigned char
+oscillator_morph(OSCILLATOR_MORPH *p_morph, OSCILLATOR_STATE *p_state, unsigned char uc_sample_index, unsigned char uc_row)
+{
+	unsigned char	uc_sample,
+					uc_sample_a,
+					uc_sample_b,
+					uc_index;
+					
+	unsigned int	un_sample_calc;
+	
+	signed int sn_temp;
+	
+	/*Each tick of the morph timer is one sample period of this oscillator, 1/32768 = 30 microseconds.*/
+	if(p_state->un_morph_timer == 0)
+	{
+		if(!(p_morph->uc_flags & MORPH_PING_PONG))
+		{
+			p_state->un_morph_index++;
+		}
+		else if(p_state->uc_morph_state == 0)
+		{
+			p_state->un_morph_index++;
+
+			if(p_state->un_morph_index >= p_morph->un_length - 1)
+			{
+				p_state->uc_morph_state = 1;
+			}
+		}
+		else
+		{
+			p_state->un_morph_index--;
+
+			if(p_state->un_morph_index == 0)
+			{
+				p_state->uc_morph_state = 0;
+			}
+		}
+		
+		p_state->un_morph_timer = p_morph->un_period;
+	}
+
+	p_state->un_morph_timer--;
+	
+	if(p_morph->uc_shift_period != 0)
+	{
+		p_state->uc_phase_shift_timer--;
+
+		if(p_state->uc_phase_shift_timer == 0)
+		{
+			p_state->uc_phase_shifter++;
+			p_state->uc_phase_shift_timer = p_morph->uc_shift_period;
+		}
+	}
+	
+	uc_index = p_state->un_morph_index;//The 256 step morphs only look at the bottom byte
+	
+	uc_sample_a = oscillator_morph_source(p_morph->uc_source_a, oscillator_morph_offset(p_morph->uc_offset_a, p_state, uc_index), uc_sample_index, uc_row);
+	uc_sample_b = oscillator_morph_source(p_morph->uc_source_b, oscillator_morph_offset(p_morph->uc_offset_b, p_state, uc_index), uc_sample_index, uc_row);
+	
+	switch(p_morph->uc_combine)
+	{
+		case MORPH_COMBINE_DIFFERENCE:
+		
+			/*Now we'll have a positive or negative number. We have to center it around 127 and make sure
+			that the sample is never going to be over 255 or less than 0.*/
+			sn_temp = uc_sample_a - uc_sample_b;
+			
+			if(sn_temp > 127)
+			{
+				uc_sample = 255;
+			}
+			else if(sn_temp < -128)
+			{
+				uc_sample = 0;
+			}
+			else
+			{
+				uc_sample = 128 + sn_temp;
+			}
+			
+		break;
+		
+		case MORPH_COMBINE_CROSSFADE:
+		
+			un_sample_calc = uc_sample_a*uc_index;
+			un_sample_calc += uc_sample_b*(255 - uc_index);
+			uc_sample = un_sample_calc >> 8;
+			
+		break;
+		
+		default://MORPH_COMBINE_ENVELOPES
+		
+			/*The first oscillator rises in over the first 255 steps, the second falls away from step 129 to 382.
+			Each is silent outside its part of the morph.*/
+			if(p_state->un_morph_index < 255)
+			{
+				un_sample_calc = uc_sample_a;
+				un_sample_calc *= wavetable_ramp_simple(p_state->un_morph_index);
+				uc_sample_a = un_sample_calc >> 8;
+			}
+			else
+			{
+				uc_sample_a = 0;
+			}
+			
+			if(p_state->un_morph_index > 128 && p_state->un_morph_index < 383)
+			{
+				un_sample_calc = uc_sample_b;
+				un_sample_calc *= 255 - wavetable_sin((unsigned char)(p_state->un_morph_index - 128));
+				uc_sample_b = un_sample_calc >> 8;
+			}
+			else
+			{
+				uc_sample_b = 0;
+			}
+			
+			un_sample_calc = uc_sample_a + uc_sample_b;
+			uc_sample = un_sample_calc >> 1;
+			
+		break;
+	}
+	
+	/*Wrapping after the sample rather than before means a 256 step morph plays its step 256 as step 0, which is
+	the same thing, and the 383 step ones play one sample of silence at the end, like they always have.*/
+	if(!(p_morph->uc_flags & MORPH_PING_PONG) && p_state->un_morph_index >= p_morph->un_length)
+	{
+		p_state->un_morph_index = 0;
+	}
+	
+	return uc_sample;
+}
+
+/*
+@brief This function works out a morph source's offset.
+
+@param It takes the MORPH_OFFSET_, the oscillator's state and the bottom byte of the morph index.
+
+@return It returns the offset to add to the sample index, or the pulse width for MORPH_SOURCE_SQUARE.
+*/
+static unsigned char
+oscillator_morph_offset(unsigned char uc_offset, OSCILLATOR_STATE *p_state, unsigned char uc_index)
+{
+	switch(uc_offset)
+	{
+		case MORPH_OFFSET_HALF:			return 127;
+		case MORPH_OFFSET_SHIFTER:		return p_state->uc_phase_shifter;
+		case MORPH_OFFSET_INDEX:		return uc_index;
+		case MORPH_OFFSET_MINUS_INDEX:	return -uc_index;
+		default:						return 0;
+	}
+}
+
+/*
+@brief This function fetches one of a morph's two samples.
+
+@param It takes the MORPH_SOURCE_, the offset from oscillator_morph_offset(), the sample index and the wavetable row.
+
+@return It returns the sample.
+*/
+static unsigned char
+oscillator_morph_source(unsigned char uc_source, unsigned char uc_offset, unsigned char uc_sample_index, unsigned char uc_row)
+{
+	if(MORPH_SOURCE_SQUARE == uc_source)
+	{
+		return calculate_square(uc_sample_index, uc_row, uc_offset);
+	}
+	
+	uc_sample_index += uc_offset;
+	
+	switch(uc_source)
+	{
+		case MORPH_SOURCE_SIN:			return wavetable_sin(uc_sample_index);
+		case MORPH_SOURCE_RAMP_SIMPLE:	return wavetable_ramp_simple(uc_sample_index);
+		case MORPH_SOURCE_TRIANGLE:		return wavetable_triangle(uc_row, uc_sample_index);
+		default:						return wavetable_ramp(uc_row, uc_sample_index);
+	}
+}
+
+/*
+calculate_square
+@brief This function calculates a square wave by summing two out of phase ramp waves. 
+The duty cycle of the square wave is adjustable.
+
+@param  uc_sample_index - This tells the function which sample to access on the time scale.
+		uc_frequency - This tells the function which wavetable to access on the MIDI scale.
+		uc_pulse_width - This determines the pulse_width. 0 = 50%, 127 = 1%
+
+@return It returns an appropriate square wave sample value.
+*/
+unsigned char
+calculate_square(unsigned char uc_sample_index, unsigned char uc_frequency, unsigned char uc_pulse_width)
+{
+	unsigned char uc_temp,
+				  uc_sample,
+				  uc_reverse_sample_index;
+	signed int sn_temp;
+	
+	uc_reverse_sample_index = uc_sample_index - uc_pulse_width;
+			
+	uc_temp = wavetable_ramp(uc_frequency, uc_sample_index);
+		
+	sn_temp = uc_temp - wavetable_ramp(uc_frequency, uc_reverse_sample_index);
+
+	/*Now we'll have a positive or negative number. We have to center it around 127 and make sure
+	that the sample is never going to be over 255 or less than 0.*/
+	if(sn_temp > 127)
+	{
+		uc_sample = 255;
+	}
+	else if(sn_temp < -128)
+	{
+		uc_sample = 0;
+	}
+	else
+	{
+		uc_sample = 128 + sn_temp;
+	}
+	
+	return uc_sample;
+}
+
+
+/*
+Linear Interpolation
+The top 8 bits give us the index = x1
+The bottom 8 bits give us the next index = x2
+So, we add x1 + (x1-x2)*(bottom 7 bits)/128	
+*/	
+unsigned char 
+linear_interpolate(unsigned char uc_reference, unsigned char uc_sample_1, unsigned char uc_sample_2)
+{
+	signed int sn_difference;
+	unsigned char uc_result;
+		
+	sn_difference = uc_sample_2 - uc_sample_1;
+	
+	sn_difference *= uc_reference;
+	
+	sn_difference >>= 8;
+	
+	uc_result = uc_sample_1 + sn_difference;
+
+	return uc_result;
+	
+}
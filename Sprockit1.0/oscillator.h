@@ -1,44 +1,146 @@
-/*
-	This file is part of Sprockit.
-
-    Sprockit is free software: you can redistribute it and/or modify
-    it under the terms of the GNU General Public License as published by
-    the Free Software Foundation, either version 3 of the License, or
-    (at your option) any later version.
-
-    Sprockit is distributed in the hope that it will be useful,
-    but WITHOUT ANY WARRANTY; without even the implied warranty of
-    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
-    GNU General Public License for more details.
-
-    You should have received a copy of the GNU General Public License
-    along with Sprockit.  If not, see <http://www.gnu.org/licenses/>
-*/
-
-#ifndef OSCILLATOR_H
-#define OSCILLATOR_H
-
-#define MORPH_1_TIME_PERIOD 50
-#define MORPH_2_TIME_PERIOD	10
-#define PHASE_SHIFT_TIMER_2	50
-
-#define OSCILLATOR_1	0
-#define OSCILLATOR_2	1
-#define OSCILLATOR_MIX	2
-
-const unsigned char AUC_OSCILLATOR_LUT[32][3];
-
-void
-decode_oscillator_waveshape(volatile g_setting *p_global_setting, unsigned char ucwaveshape);
-
-unsigned char 
-oscillator(unsigned char uc_waveshape, unsigned int un_sample_reference, unsigned char uc_frequency);
-
-unsigned char
-calculate_square(unsigned char uc_sample_index, unsigned char uc_frequency, unsigned char uc_pulse_width);
-
-unsigned char 
-linear_interpolate(unsigned char uc_reference, unsigned char uc_sample_1, unsigned char uc_sample_2);
-
-
-#endif /*OSCILLATOR_H*/
+/*
+	This file is part of Sprockit.
+
+    Sprockit is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Sprockit is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Sprockit.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef OSCILLATOR_H
+#define OSCILLATOR_H
+
+#define MORPH_1_TIME_PERIOD 50
+#define MORPH_2_TIME_PERIOD	10
+#define PHASE_SHIFT_TIMER_2	50
+
+#define OSCILLATOR_1	0
+#define OSCILLATOR_2	1
+#define OSCILLATOR_MIX	2
+#define OSCILLATOR_SYNC	3
+
+const unsigned char AUC_OSCILLATOR_LUT[32][4];
+
+/*Everything an oscillator remembers from one sample to the next, apart from its sample reference.
+There's one of these for each oscillator so their morphs and noise run independently.*/
+typedef struct
+{
+	unsigned char uc_morph_state;		//0 morphing up, 1 morphing back down
+	unsigned char uc_phase_shifter;		//Phase offset between the two blended tables
+	unsigned char uc_phase_shift_timer;	//Samples until the phase offset moves
+	unsigned int un_morph_index;		//How far along the morph is
+	unsigned int un_morph_timer;		//Samples until the morph moves another step
+	unsigned int un_lfsr;				//The noise generator's shift register
+} OSCILLATOR_STATE;
+
+extern OSCILLATOR_STATE g_ast_oscillator_state[NUMBER_OF_OSCILLATORS];
+
+//Morph sources, where a morph gets each of its two samples
+#define MORPH_SOURCE_SIN			0	//wavetable_sin()
+#define MORPH_SOURCE_RAMP_SIMPLE	1	//G_AUC_RAMP_SIMPLE_WAVETABLE_LUT
+#define MORPH_SOURCE_RAMP			2	//The ramp wavetable row for the note
+#define MORPH_SOURCE_TRIANGLE		3	//The triangle wavetable row for the note
+#define MORPH_SOURCE_SQUARE			4	//calculate_square(), the offset is its pulse width
+
+//Morph offsets, what gets added to a source's sample index
+#define MORPH_OFFSET_NONE			0
+#define MORPH_OFFSET_HALF			1	//Half a cycle, 127
+#define MORPH_OFFSET_SHIFTER		2	//The phase shifter, which creeps along every uc_shift_period samples
+#define MORPH_OFFSET_INDEX			3	//The morph index
+#define MORPH_OFFSET_MINUS_INDEX	4	//Minus the morph index
+
+//Morph combine operations, how the two samples make one
+#define MORPH_COMBINE_DIFFERENCE	0	//a - b centered on 128 and clipped, the way calculate_square() does it
+#define MORPH_COMBINE_CROSSFADE		1	//a faded into b as the index goes from 255 down to 0
+#define MORPH_COMBINE_ENVELOPES		2	//a rising in on the simple ramp, then b falling away on the sin, over 383 steps
+
+//Morph flags
+#define MORPH_PING_PONG		0x01	//The index goes up to un_length - 1 and back down, rather than wrapping at un_length
+#define MORPH_KEEP_PLACE	0x02	//A new note doesn't start the morph over
+
+#define NUMBER_OF_MORPHS	9	//MORPH_1 to MORPH_9
+
+/*One row of the morph table. Every morphing waveshape is two samples, each from a source with an offset, put together
+by a combine operation as the morph index moves along by one every un_period samples. A new morph is a new row.*/
+typedef struct
+{
+	unsigned char uc_source_a;		//MORPH_SOURCE_
+	unsigned char uc_offset_a;		//MORPH_OFFSET_
+	unsigned char uc_source_b;
+	unsigned char uc_offset_b;
+	unsigned char uc_combine;		//MORPH_COMBINE_
+	unsigned char uc_flags;			//MORPH_PING_PONG, MORPH_KEEP_PLACE
+	unsigned char uc_shift_period;	//Samples per phase shifter step, 0 if it doesn't use the phase shifter
+	unsigned int un_period;			//Samples per morph step
+	unsigned int un_length;			//Morph steps before it wraps or turns around
+} OSCILLATOR_MORPH;
+
+extern const OSCILLATOR_MORPH AST_OSCILLATOR_MORPH_LUT[NUMBER_OF_MORPHS];
+
+#define OSCILLATOR_PLAN_STALE	0xFF	//A waveshape no plan is ever built for, so the next update rebuilds it
+
+/*The render plan. Everything about an oscillator that only changes when its waveshape or note changes is worked out
+here at control rate, so per sample there's just a call through pf_kernel, a couple of table loads and the blend.*/
+typedef struct OSCILLATOR_PLAN_TAG
+{
+	unsigned char (*pf_kernel)(struct OSCILLATOR_PLAN_TAG *p_plan, OSCILLATOR_STATE *p_state, unsigned int un_phase);
+	const unsigned char *p_uc_row_1;	//The wavetable row (in program memory) for this note
+	const unsigned char *p_uc_row_2;	//The neighbouring row it gets blended with
+	unsigned char uc_weight_1;			//Blend weights out of 256 for the two rows
+	unsigned char uc_weight_2;
+	unsigned char uc_waveshape;			//What the plan was built for
+	unsigned char uc_frequency;
+	unsigned char uc_morph_rate;
+	OSCILLATOR_MORPH st_morph;			//The morph table row, with its periods scaled by the morph rate
+} OSCILLATOR_PLAN;
+
+extern OSCILLATOR_PLAN g_ast_oscillator_plan[NUMBER_OF_OSCILLATORS];
+
+void
+decode_oscillator_waveshape(volatile g_setting *p_global_setting, unsigned char ucwaveshape);
+
+void
+initialize_oscillators(void);
+
+void
+oscillator_sync(OSCILLATOR_STATE *p_state, unsigned char uc_waveshape);
+
+void
+oscillator_plan_update(OSCILLATOR_PLAN *p_plan, unsigned char uc_waveshape, unsigned char uc_frequency, unsigned char uc_morph_rate);
+
+void
+oscillator_plan_scan(OSCILLATOR_PLAN *p_plan, unsigned char uc_position);
+
+unsigned char
+oscillator_scan_position(g_setting *p_global_setting);
+
+void
+oscillator_morph_load(OSCILLATOR_MORPH *p_morph, unsigned char uc_waveshape, unsigned char uc_morph_rate);
+
+unsigned char
+oscillator_morph(OSCILLATOR_MORPH *p_morph, OSCILLATOR_STATE *p_state, unsigned char uc_sample_index, unsigned char uc_row);
+
+unsigned char 
+oscillator(OSCILLATOR_STATE *p_state, unsigned char uc_waveshape, unsigned int un_sample_reference, unsigned char uc_frequency);
+
+unsigned char
+calculate_square(unsigned char uc_sample_index, unsigned char uc_frequency, unsigned char uc_pulse_width);
+
+#if ASM_KERNELS && ASM_KERNEL_CHECK
+void
+oscillator_kernel_check(void);
+#endif
+
+unsigned char 
+linear_interpolate(unsigned char uc_reference, unsigned char uc_sample_1, unsigned char uc_sample_2);
+
+
+#endif /*OSCILLATOR_H*/
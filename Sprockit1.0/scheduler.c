@@ -0,0 +1,368 @@
+/*
+@file scheduler.c
+
+@brief This module decides which of the slow tasks run on each slow tick (3200Hz).
+
+Every task in the table says how often it wants to run, which tick of its period it runs on and how long it
+takes at worst. Its rate comes from its own entry and nothing else, so adding a task doesn't slow down the
+envelopes or the LFO the way the old round robin did. The phases are there to spread the slower tasks out
+so they don't all pile up on the same tick.
+
+At start up the table is checked against the tick budget over a whole hyperperiod, and while running we
+measure how long each task really takes and how much of every tick is left over, so there is a number to
+look at before adding something new.
+
+This file is part of Sprockit.
+
+    Sprockit is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Sprockit is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Sprockit.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#include <io.h>
+#include <pgmspace.h>
+#include <sprockit_main.h>
+#include <scheduler.h>
+#include <spi.h>
+#include <read_ad.h>
+#include <calculate_pitch.h>
+#include <lfo.h>
+#include <amp_adsr.h>
+#include <led_switch_handler.h>
+#include <midi.h>
+#include <midi_clock.h>
+#include <uart.h>
+#include <arpeggiator.h>
+#include <audio_block.h>
+#include <stack_monitor.h>
+
+signed int g_sn_scheduler_planned_slack;
+unsigned char g_uc_scheduler_min_slack = 0xFF;
+unsigned char g_uc_scheduler_average_slack;
+unsigned char g_uc_scheduler_overrun_count;
+unsigned char g_auc_scheduler_task_max_cost[SCHEDULER_NUMBER_OF_TASKS];
+
+static unsigned char auc_scheduler_countdown[SCHEDULER_NUMBER_OF_TASKS];	//Ticks until each task is due again
+static unsigned int un_scheduler_slack_sum;		//Slack added up over the current averaging window
+static unsigned char uc_scheduler_window_ticks;	//Ticks so far in the current averaging window
+
+static void scheduler_task_arpeggiator(g_setting *p_global_setting);
+static void scheduler_task_envelope(g_setting *p_global_setting);
+static void scheduler_task_switches(g_setting *p_global_setting);
+static void scheduler_task_midi_receive(g_setting *p_global_setting);
+static void scheduler_task_spi(g_setting *p_global_setting);
+static void scheduler_task_read_ad(g_setting *p_global_setting);
+static void scheduler_task_midi_dispatch(g_setting *p_global_setting);
+static void scheduler_task_stack_monitor(g_setting *p_global_setting);
+
+/*The task table. The costs are estimates in TIMER0 counts, check them against g_auc_scheduler_task_max_cost.
+The 640Hz tasks keep the rate and order they had in the old round robin, since the envelope, portamento and
+LFO rates are all counted in calls. The fifth slot the midi task used to take is slack, apart from the stack
+monitor once a hyperperiod.
+It lives in program memory, so every field is read with pgm_read_.*/
+static const SCHEDULER_TASK AST_SCHEDULER_TASKS[SCHEDULER_NUMBER_OF_TASKS] PROGMEM =
+{
+	//task							period	phase	cost
+	{scheduler_task_arpeggiator,	1,		0,		3},	//First, so the steps land on exact ticks.
+	{scheduler_task_envelope,		1,		0,		6},
+	{scheduler_task_switches,		1,		0,		8},
+	{scheduler_task_midi_receive,	1,		0,		4},	//Clock position and the uart ring, every tick to keep time.
+	{scheduler_task_spi,			5,		0,		6},	//640Hz
+	{scheduler_task_read_ad,		5,		1,		10},//640Hz
+	{calculate_pitch,				5,		2,		24},//640Hz
+	{lfo,							5,		3,		12},//640Hz
+	{scheduler_task_stack_monitor,	80,		4,		8},	//40Hz, on a tick none of the 640Hz tasks use.
+	{scheduler_task_midi_dispatch,	1,		0,		SCHEDULER_COST_FILLS_SLACK},//Last, it gets whatever is left.
+};
+
+/*
+@brief This function sets every task up to run on its phase and works out the planned slack of the
+table, the budget left on the busiest tick of a whole hyperperiod.
+
+@param It takes no parameters.
+
+@return It doesn't return anything. The planned slack ends up in g_sn_scheduler_planned_slack.
+*/
+void
+scheduler_init(void)
+{
+	unsigned char uc_tick;
+	unsigned char uc_task;
+	unsigned int un_load;
+	unsigned int un_worst_load = 0;
+
+	for(uc_task = 0; uc_task < SCHEDULER_NUMBER_OF_TASKS; uc_task++)
+	{
+		auc_scheduler_countdown[uc_task] = pgm_read_byte(&AST_SCHEDULER_TASKS[uc_task].uc_phase);
+		g_auc_scheduler_task_max_cost[uc_task] = 0;
+	}
+
+	for(uc_tick = 0; uc_tick < SCHEDULER_HYPERPERIOD; uc_tick++)
+	{
+		un_load = 0;
+
+		for(uc_task = 0; uc_task < SCHEDULER_NUMBER_OF_TASKS; uc_task++)
+		{
+			if((uc_tick % pgm_read_byte(&AST_SCHEDULER_TASKS[uc_task].uc_period)) == pgm_read_byte(&AST_SCHEDULER_TASKS[uc_task].uc_phase))
+			{
+				un_load += pgm_read_byte(&AST_SCHEDULER_TASKS[uc_task].uc_cost);
+			}
+		}
+
+		if(un_load > un_worst_load)
+		{
+			un_worst_load = un_load;
+		}
+	}
+
+	g_sn_scheduler_planned_slack = SCHEDULER_TICK_BUDGET - (signed int)un_worst_load;
+}
+
+/*
+@brief This function runs every task that is due on this slow tick, in table order, timing each one with
+TIMER0. Then it writes down how much of the tick was left.
+
+@param It takes the global setting structure, which it hands to each task.
+
+@return It doesn't return anything.
+
+The caller clears the slow interrupt flag before calling, so if the flag is set again when we're done, the
+tick overran.
+*/
+void
+scheduler_run_tick(g_setting *p_global_setting)
+{
+	unsigned char uc_task;
+	unsigned char uc_start;
+	unsigned char uc_cost;
+	unsigned char uc_slack;
+	void (*pf_task)(g_setting *p_global_setting);
+
+	for(uc_task = 0; uc_task < SCHEDULER_NUMBER_OF_TASKS; uc_task++)
+	{
+		if(auc_scheduler_countdown[uc_task] == 0)
+		{
+			auc_scheduler_countdown[uc_task] = pgm_read_byte(&AST_SCHEDULER_TASKS[uc_task].uc_period) - 1;
+			memcpy_P(&pf_task, &AST_SCHEDULER_TASKS[uc_task].pf_task, sizeof(pf_task));
+
+			uc_start = TCNT0;
+			pf_task(p_global_setting);
+			uc_cost = TCNT0;
+
+			//If the timer went around, the task crossed into the next tick.
+			if(uc_cost < uc_start)
+			{
+				uc_cost += SCHEDULER_TICK_COUNTS;
+			}
+			uc_cost -= uc_start;
+
+			if(uc_cost > g_auc_scheduler_task_max_cost[uc_task])
+			{
+				g_auc_scheduler_task_max_cost[uc_task] = uc_cost;
+			}
+
+#if AUDIO_BLOCK_RENDERING
+			//Top up the output ring between tasks, so a busy tick can't starve it.
+			audio_block_render(p_global_setting);
+#endif
+		}
+		else
+		{
+			auc_scheduler_countdown[uc_task]--;
+		}
+	}
+
+	if(g_uc_slow_interrupt_flag == 1)
+	{
+		uc_slack = 0;
+
+		if(g_uc_scheduler_overrun_count < 0xFF)
+		{
+			g_uc_scheduler_overrun_count++;
+		}
+	}
+	else
+	{
+		uc_slack = SCHEDULER_TICK_COUNTS - TCNT0;
+	}
+
+	if(uc_slack < g_uc_scheduler_min_slack)
+	{
+		g_uc_scheduler_min_slack = uc_slack;
+	}
+
+	un_scheduler_slack_sum += uc_slack;
+	uc_scheduler_window_ticks++;
+
+	if(uc_scheduler_window_ticks == 0)//Wrapped, so that's 256 ticks
+	{
+		g_uc_scheduler_average_slack = un_scheduler_slack_sum >> LOG_SCHEDULER_SLACK_WINDOW;
+		un_scheduler_slack_sum = 0;
+	}
+}
+
+/*
+@brief The arpeggiator task. It only steps while the arpeggiator is switched on.
+
+@param It takes the global setting structure.
+
+@return It doesn't return anything.
+*/
+static void
+scheduler_task_arpeggiator(g_setting *p_global_setting)
+{
+	static unsigned char uc_arpeggiator_running;//TRUE if the arpeggiator ran last tick
+
+	if(p_global_setting->auc_synth_params[ARPEGGIATOR_MODE] != 0)
+	{
+		arpeggiator(p_global_setting);
+		uc_arpeggiator_running = TRUE;
+	}
+	else if(uc_arpeggiator_running == TRUE)
+	{
+		//It was just turned off. Give the key back to whatever is still being held so nothing hangs.
+		g_uc_key_press_flag = (midi_get_number_of_active_notes() != 0);
+		uc_arpeggiator_running = FALSE;
+	}
+}
+
+/*
+@brief The envelope task. It calculates the adsr envelope value and sets the amplitude of the
+Voltage-Controlled Amplifier from it.
+
+@param It takes the global setting structure.
+
+@return It doesn't return anything.
+*/
+static void
+scheduler_task_envelope(g_setting *p_global_setting)
+{
+	adsr(p_global_setting);
+	set_amplitude(p_global_setting);
+}
+
+/*
+@brief The switch task. It counts down the debounce timer and handles a tact switch press once it has run out.
+
+@param It takes the global setting structure.
+
+@return It doesn't return anything.
+*/
+static void
+scheduler_task_switches(g_setting *p_global_setting)
+{
+	if(g_un_switch_debounce_timer > 0)
+	{
+		g_un_switch_debounce_timer--;
+	}
+	else if(g_uc_ext_int_0_flag ==  TRUE)
+	{
+		led_switch_handler(p_global_setting, TACT_LFO_SHAPE);
+		g_uc_ext_int_0_flag = FALSE;
+		CLEAR_EXT_INTERRUPTS;
+		ENABLE_EXT_INT_0;
+	}
+	else if(g_uc_ext_int_1_flag == TRUE)
+	{
+		led_switch_handler(p_global_setting, TACT_LFO_DEST);
+		g_uc_ext_int_1_flag = FALSE;
+		CLEAR_EXT_INTERRUPTS
+		ENABLE_EXT_INT_1;
+	}
+}
+
+/*
+@brief The midi receive task. It moves the MIDI clock position along and empties the uart receive ring into
+the incoming midi handler routine, which assembles the bytes into messages for the incoming midi fifo.
+
+@param It takes the global setting structure, which it doesn't need.
+
+@return It doesn't return anything.
+*/
+static void
+scheduler_task_midi_receive(g_setting *p_global_setting)
+{
+	midi_clock_tick();
+
+	while(uart_rx_buffer_has_byte())
+	{
+		handle_incoming_midi_byte(uart_get_byte());
+	}
+}
+
+/*
+@brief The SPI task. The SPI is shared by the i/o expanders and the digital pots of the
+filter. These tasks are mutually exclusive though, only one at a time.
+
+@param It takes the global setting structure, which it doesn't need.
+
+@return It doesn't return anything.
+*/
+static void
+scheduler_task_spi(g_setting *p_global_setting)
+{
+	spi();
+}
+
+/*
+@brief The knob task. It reads the last finished conversion if the AD isn't busy.
+
+@param It takes the global setting structure.
+
+@return It doesn't return anything.
+*/
+static void
+scheduler_task_read_ad(g_setting *p_global_setting)
+{
+	if(!CHECK_BIT(ADCSRA, ADSC))
+	{
+		read_ad(p_global_setting);
+		g_uc_ad_ready_flag = 0;
+	}
+}
+
+/*
+@brief The midi dispatch task. It interprets the waiting midi messages, as many as fit in what's left
+of the tick, or just one if batched dispatch is turned off.
+
+@param It takes the global setting structure.
+
+@return It doesn't return anything.
+*/
+static void
+scheduler_task_midi_dispatch(g_setting *p_global_setting)
+{
+	MIDI_MESSAGE mm_incoming_message;
+
+	if(MIDI_MESSAGE_INCOMING_BATCHED_DISPATCH)
+	{
+		midi_dispatch_incoming_messages(p_global_setting);
+	}
+	else if(g_uc_midi_messages_in_incoming_fifo > 0)
+	{
+		get_midi_message_from_incoming_fifo(&mm_incoming_message);
+		midi_interpret_incoming_message(&mm_incoming_message, p_global_setting);
+	}
+}
+
+/*
+@brief The stack monitor task. It moves the scan for the deepest the stack has been along a little.
+
+@param It takes the global setting structure, which it doesn't need.
+
+@return It doesn't return anything.
+*/
+static void
+scheduler_task_stack_monitor(g_setting *p_global_setting)
+{
+	stack_monitor_scan();
+}
@@ -0,0 +1,58 @@
+/*
+	This file is part of Sprockit.
+
+    Sprockit is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Sprockit is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Sprockit.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#define SCHEDULER_TICK_COUNTS		96		//TIMER0 counts in a slow tick (OCR0A + 1). One count is 64 cpu cycles.
+#define SCHEDULER_TICK_BUDGET		64		//TIMER0 counts per tick the fixed rate tasks may plan to use. The midi dispatcher
+											//takes what's left up to here (MIDI_DISPATCH_TIMER0_BUDGET), the rest belongs
+											//to the sample interrupt that keeps landing on top of us.
+#define SCHEDULER_HYPERPERIOD		80		//Every task period has to divide this. 80 ticks is 40Hz at the 3200Hz slow tick.
+#define SCHEDULER_NUMBER_OF_TASKS	10		//Entries in AST_SCHEDULER_TASKS. Keep them in step.
+#define SCHEDULER_COST_FILLS_SLACK	0		//Cost of a task that stops by itself when the tick runs out.
+#define LOG_SCHEDULER_SLACK_WINDOW	8		//The average slack is taken over 256 ticks.
+
+/*Reads the slow tick count and TIMER0 together, for timing things that can run longer than a tick. If the tick
+interrupt lands between the two reads, read them again. It has to be called with interrupts on.*/
+#define SCHEDULER_TIMER0_READ(uc_ticks, uc_counts) do{ do{ uc_ticks = g_uc_slow_tick_count; uc_counts = TCNT0; }while(uc_ticks != g_uc_slow_tick_count); }while(0)
+
+/*One entry of the task table. A task runs on the ticks where (tick % uc_period) == uc_phase, so its rate
+never changes when other tasks come or go. Tasks due on the same tick run in table order.*/
+typedef struct
+{
+	void (*pf_task)(g_setting *p_global_setting);
+	unsigned char uc_period;	//Run once every this many slow ticks
+	unsigned char uc_phase;		//Which tick of the period to run on, 0 to uc_period - 1
+	unsigned char uc_cost;		//Worst case run time in TIMER0 counts, sample interrupts included
+} SCHEDULER_TASK;
+
+//Slack report. Read these with a debugger or send them out over MIDI.
+extern signed int g_sn_scheduler_planned_slack;		//Budget left on the busiest tick of the table. Negative means overbooked.
+extern unsigned char g_uc_scheduler_min_slack;			//Fewest TIMER0 counts ever left over at the end of a tick
+extern unsigned char g_uc_scheduler_average_slack;		//Average counts left over at the end of a tick, last 256 ticks
+extern unsigned char g_uc_scheduler_overrun_count;		//Ticks that ran into the next one. Saturates at 255.
+extern unsigned char g_auc_scheduler_task_max_cost[SCHEDULER_NUMBER_OF_TASKS];	//Longest each task has been seen to take
+
+//Function prototypes
+void
+scheduler_init(void);
+
+void
+scheduler_run_tick(g_setting *p_global_setting);
+
+#endif
@@ -1,190 +1,243 @@
-/*
-	This file is part of Sprockit.
-
-    Sprockit is free software: you can redistribute it and/or modify
-    it under the terms of the GNU General Public License as published by
-    the Free Software Foundation, either version 3 of the License, or
-    (at your option) any later version.
-
-    Sprockit is distributed in the hope that it will be useful,
-    but WITHOUT ANY WARRANTY; without even the implied warranty of
-    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
-    GNU General Public License for more details.
-
-    You should have received a copy of the GNU General Public License
-    along with Sprockit.  If not, see <http://www.gnu.org/licenses/>
-*/
-
-#ifndef SPROCKIT_MAIN_H
-#define SPROCKIT_MAIN_H
-
-
-//Macros
-#define SET_BIT(address, bit) (address |= (1<<bit))
-#define CLEAR_BIT(address, bit) (address &= ~(1<<bit))
-#define CHECK_BIT(address, bit) (address & (1<<bit))
-#define FALSE 	0
-#define TRUE	1
-#define RESET_WATCHDOG MCUSR = 0
-#define POT_MUX_SEL1(bit) PORTB |= (bit<<PB1)
-#define POT_MUX_SEL0(bit) PORTB |= bit
-#define RESULT_IS_NEGATIVE	CHECK_BIT(SREG, 2)
-#define RESULT_IS_POSITIVE	!CHECK_BIT(SREG, 2)
-#define RESULT_TWOS_COMPLEMENT_OVERFLOW	CHECK_BIT(SREG, 3)
-
-//Sample rate related constants
-#define SAMPLE_FREQUENCY  	    	32768	
-#define SAMPLE_MAX 				    32767 //highest sample
-#define THREE_QUARTER_SAMPLE_MAX	24575 //3/4 of highest sample
-#define HALF_SAMPLE_MAX			    16383 //half of the highest sample
-#define QUARTER_SAMPLE_MAX		    8191 //1/4 of highest sample
-
-#define OFF	0
-#define ON	1
-
-//Waveshapes
-#define SIN				0
-#define	RAMP			1
-#define	SQUARE			2
-#define	TRIANGLE		3
-#define	MORPH_1			4
-#define MORPH_2			5
-#define MORPH_3			6
-#define MORPH_4			7
-#define MORPH_5			8
-#define MORPH_6			9
-#define MORPH_7			10
-#define MORPH_8			11
-#define MORPH_9			12
-#define HARD_SYNC		13
-#define NOISE			14 
-#define RAW_SQUARE		15
-
-//Oscillator
-#define NUMBER_OF_OSCILLATORS	2
-#define NUM_OF_SAMPLES 		 	16
-#define LOG_NUM_OF_SAMPLES 	 	4
-#define OSC_1					0
-#define OSC_2					1
-
-
-
-//Auxilliary Task States
-#define AUX_TASK_AMPLITUDE 		0
-#define AUX_TASK_SPI		    0
-#define AUX_TASK_READ_AD    	1
-#define AUX_TASK_CALC_PITCH		2
-#define AUX_TASK_LFO			3
-#define AUX_TASK_MIDI			4
-
-//Control Signal Sources
-#define SOURCE_AD 			0	//Internal knob controls
-#define SOURCE_LOOP			1	//Stored loop values
-#define SOURCE_EXTERNAL 		2	//EEPROM recalled value or MIDI loaded values
-
-//Knobs/Pots
-#define NUMBER_OF_KNOBS				8	//The A to D has to know how many knobs to loop through
-#define NUMBER_OF_MUX_KNOBS			8
-#define NUMBER_OF_LOOP_KNOBS		8  //Number of knobs for the drone loop function 
-#define NUMBER_OF_KNOB_PARAMETERS	8  //Number of ADs plus the LFO parameters which are like imaginary knobs
-#define NUMBER_OF_PARAMETERS		32	//The total number of parameters including button set parameters
-//ADSR Parameters/Knobs - these constants are used as indexes to access members of the ADSR array
-#define FILTER_Q			0
-#define LFO_RATE			1
-#define FILTER_FREQUENCY	2
-#define OSC_DETUNE			3
-#define ADSR_LENGTH			4
-#define LFO_AMOUNT			5
-#define OSC_WAVESHAPE		6
-#define ADSR_ATTACK			7
-
-#define FILTER_SUSTAIN		8
-#define FILTER_ENV_AMT		9
-#define FILTER_ATTACK		10
-#define OSC_MIX				11
-#define LFO_SHAPE			12
-#define FILTER_DECAY		13
-#define	ADSR_RELEASE		14
-#define OSC_1_WAVESHAPE		15
-#define OSC_2_WAVESHAPE		16
-#define	ADSR_SUSTAIN		17
-#define FILTER_RELEASE		18
-#define PITCH_SHIFT			19
-#define AMPLITUDE			20
-#define LFO_DEST			21
-#define FILTER_TYPE			22
-#define LFO_WAVESHAPE		23
-#define LFO_SYNC			24
-#define PORTAMENTO			25
-#define ARPEGGIATOR_MODE	26
-#define ARPEGGIATOR_SPEED	27
-#define ARPEGGIATOR_LENGTH	28
-#define ARPEGGIATOR_GATE	29
-#define ADSR_DECAY			30
-
-//SPI Related Constants and Macros
-#define SPI_TX_BUF_LGTH    				3
-#define CLEAR_EXT_INTERRUPTS			EIFR |= 0xFF;
-#define ENABLE_EXT_INT_0   				EIMSK |= (1 << INT0)  
-#define DISABLE_EXT_INT_0  				EIMSK &= ~(1 << INT0)
-#define ENABLE_EXT_INT_1   				EIMSK |= (1 << INT1) 
-#define DISABLE_EXT_INT_1  				EIMSK &= ~(1 << INT1)
-
-
-//Global Variables - They should always be volatile and prefixed by g_.
-//Global Flags
-extern unsigned char g_uc_output;//main output variable
-volatile unsigned char g_uc_spi_buffer;//Buffer for the Serial Peripheral Interface
-volatile unsigned char g_uc_sample_request_flag;//flag used to set the output and request a new sample from the state machine
-volatile unsigned char g_uc_slow_interrupt_flag;//flag set to tell events to update their values
-volatile unsigned char g_uc_key_press_flag;//flag for when a key is pressed
-volatile unsigned char g_uc_note_on_flag;//flag for generating audio output
-volatile unsigned char g_uc_ad_ready_flag;//flag used to indicate when the AD has completed a reading
-volatile unsigned char g_uc_spi_ready_flag;//flag used to indicate that the SPI has completed transmission
-volatile unsigned char g_uc_lfo_midi_sync_flag;//This flag is used to sync events to the arrival of new note on messages.
-volatile unsigned char g_uc_filter_envelope_sync_flag;//Syncs the filter envelope to notes being played
-volatile unsigned char g_uc_oscillator_midi_sync_flag;//Syncs morphing oscillators to key press
-volatile unsigned int g_un_oscillator_frequency_osc1;
-volatile unsigned int g_un_oscillator_frequency_osc2;
-volatile unsigned char g_uc_adsr_midi_sync_flag;
-volatile unsigned char g_uc_ext_int_0_flag;//Flag indicates external interrupt 0 has been triggered
-volatile unsigned char g_uc_ext_int_1_flag;//Flag indicates external interrupt 1 has been triggered
-volatile unsigned char g_uc_drone_flag;
-
-volatile unsigned int g_un_switch_debounce_timer;//Timer used to debounce switch presses
-
-
-//Global Setting Type Declaration
-//This structure holds all the settings information for the synth. We pass this structure to functions
-//to allow them to change settings.
-typedef struct
-{	
-		
-	//oscillator variables
-	unsigned int aun_sample_reference[3];	//keeps track of where we are in the cycle for each oscillator
-	unsigned char auc_midi_note_index[NUMBER_OF_OSCILLATORS];//the midi index of the note frequency
-	unsigned int aun_note_frequency[NUMBER_OF_OSCILLATORS];//the actual note frequency
-
-	//ADSR variables
-	unsigned char uc_adsr_multiplier;	//used for the ADSR calculation
-	unsigned char uc_note_velocity;		//how hard the key was hit
-
-	//Output amplitude
-	unsigned char uc_amplitude;	//main output amplitude
-	
-	//LFO variables
-	unsigned char uc_lfo_sel;	//which LFO is active for the rate/amount pots
-	unsigned char uc_lfo_sync;
-
-		
-	//parameter storage arrays
-	unsigned char auc_ad_values[NUMBER_OF_PARAMETERS];	//array containing values from the ADC
-	unsigned char auc_synth_params[NUMBER_OF_PARAMETERS];//array of synth parameters affected by the ADC readings
-	unsigned char auc_external_params[NUMBER_OF_PARAMETERS];//array containing parameter values loaded from eeprom
-	unsigned char auc_parameter_source[NUMBER_OF_PARAMETERS];/*flag array contains the source for the synth parameters, internal or external*/
-
-} g_setting;
-
-extern g_setting global_setting, *p_global_setting;
-
-#endif /*SPROCKIT_MAIN_H*/
+/*
+	This file is part of Sprockit.
+
+    Sprockit is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Sprockit is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Sprockit.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef SPROCKIT_MAIN_H
+#define SPROCKIT_MAIN_H
+
+
+//Macros
+#define SET_BIT(address, bit) (address |= (1<<bit))
+#define CLEAR_BIT(address, bit) (address &= ~(1<<bit))
+#define CHECK_BIT(address, bit) (address & (1<<bit))
+#define FALSE 	0
+#define TRUE	1
+#define RESET_WATCHDOG MCUSR = 0
+#define POT_MUX_SEL1(bit) PORTB |= (bit<<PB1)
+#define POT_MUX_SEL0(bit) PORTB |= bit
+#define RESULT_IS_NEGATIVE	CHECK_BIT(SREG, 2)
+#define RESULT_IS_POSITIVE	!CHECK_BIT(SREG, 2)
+#define RESULT_TWOS_COMPLEMENT_OVERFLOW	CHECK_BIT(SREG, 3)
+
+//Sample rate related constants
+#define SAMPLE_FREQUENCY  	    	32768	
+#define SAMPLE_MAX 				    32767 //highest sample
+#define THREE_QUARTER_SAMPLE_MAX	24575 //3/4 of highest sample
+#define HALF_SAMPLE_MAX			    16383 //half of the highest sample
+#define QUARTER_SAMPLE_MAX		    8191 //1/4 of highest sample
+#define SAMPLE_REFERENCE_WRAP		0x01000000UL //Set in a 16.8 sample reference once it goes past the end of a cycle
+#define SAMPLE_REFERENCE_MASK		0x00FFFFFFUL //Clears the wrap
+
+#define OFF	0
+#define ON	1
+
+//Assembly kernels. The host checks in tools/host build with -DASM_KERNELS=0.
+#ifndef ASM_KERNELS
+#define ASM_KERNELS				1	//1 = the per sample oscillator, mix and filter work uses the hand written AVR assembly kernels
+									//0 = it uses the C versions, which are the reference the assembly has to match
+#endif
+#ifndef ASM_KERNEL_CHECK
+#define ASM_KERNEL_CHECK		0	//1 = at start up, run every assembly kernel against its C version and time them both
+#endif
+#define ASM_KERNEL_SIN			0	//Kernel indexes into g_auc_asm_kernel_cycles
+#define ASM_KERNEL_BLEND		1
+#define ASM_KERNEL_SQUARE		2
+#define ASM_KERNEL_MIX_FILTER	3
+#define ASM_KERNEL_UNISON		4
+#define ASM_KERNEL_HALF			5
+#define ASM_KERNEL_PHASE_MOD	6
+#define NUMBER_OF_ASM_KERNELS	7
+
+/*Counts the cycles a statement takes on timer 1, which runs at the CPU clock and wraps at 256. Interrupts have to
+be off and the statement has to take less than 256 cycles. The two timer reads add 2 cycles to every count.*/
+#define ASM_KERNEL_CYCLES(uc_cycles, statement) do{ unsigned char uc_start = TCNT1L; statement; uc_cycles = TCNT1L - uc_start; }while(0)
+
+//Waveshapes
+#define SIN				0
+#define	RAMP			1
+#define	SQUARE			2
+#define	TRIANGLE		3
+#define	MORPH_1			4
+#define MORPH_2			5
+#define MORPH_3			6
+#define MORPH_4			7
+#define MORPH_5			8
+#define MORPH_6			9
+#define MORPH_7			10
+#define MORPH_8			11
+#define MORPH_9			12
+//13 was the HARD_SYNC pseudo waveshape, hard sync is OSC_SYNC now
+#define NOISE			14 
+#define RAW_SQUARE		15
+#define WAVETABLE_SCAN	16	//Crossfades through G_AUC_SCAN_WAVETABLE_LUT at SCAN_POSITION
+
+//Oscillator
+#define NUMBER_OF_OSCILLATORS	2
+#define NUM_OF_SAMPLES 		 	16
+#define LOG_NUM_OF_SAMPLES 	 	4
+#define OSC_1					0
+#define OSC_2					1
+#define OSC_SUB					2	//The sub oscillator's slot in aul_sample_reference, which counts OSC_1's cycles
+
+
+
+//Control Signal Sources
+#define SOURCE_AD 			0	//Internal knob controls
+#define SOURCE_LOOP			1	//Stored loop values
+#define SOURCE_EXTERNAL 		2	//EEPROM recalled value or MIDI loaded values
+
+//Knobs/Pots
+#define NUMBER_OF_KNOBS				8	//The A to D has to know how many knobs to loop through
+#define NUMBER_OF_MUX_KNOBS			8
+#define NUMBER_OF_LOOP_KNOBS		8  //Number of knobs for the drone loop function 
+#define NUMBER_OF_KNOB_PARAMETERS	8  //Number of ADs plus the LFO parameters which are like imaginary knobs
+#define NUMBER_OF_PARAMETERS		40	//The total number of parameters including button set parameters
+//ADSR Parameters/Knobs - these constants are used as indexes to access members of the ADSR array
+#define FILTER_Q			0
+#define LFO_RATE			1
+#define FILTER_FREQUENCY	2
+#define OSC_DETUNE			3
+#define ADSR_LENGTH			4
+#define LFO_AMOUNT			5
+#define OSC_WAVESHAPE		6
+#define ADSR_ATTACK			7
+
+#define FILTER_SUSTAIN		8
+#define FILTER_ENV_AMT		9
+#define FILTER_ATTACK		10
+#define OSC_MIX				11
+#define LFO_SHAPE			12
+#define FILTER_DECAY		13
+#define	ADSR_RELEASE		14
+#define OSC_1_WAVESHAPE		15
+#define OSC_2_WAVESHAPE		16
+#define	ADSR_SUSTAIN		17
+#define FILTER_RELEASE		18
+#define PITCH_SHIFT			19
+#define AMPLITUDE			20
+#define LFO_DEST			21	//Index into auc_lfo_dest_decode. The switch picks 0 to 2, MIDI CC 23 sends twice its value, so 4 is SCAN_POSITION and 5 and up is MORPH_RATE
+#define FILTER_TYPE			22
+#define LFO_WAVESHAPE		23
+#define LFO_SYNC			24
+#define PORTAMENTO			25
+#define ARPEGGIATOR_MODE	26
+#define ARPEGGIATOR_SPEED	27
+#define ARPEGGIATOR_LENGTH	28
+#define ARPEGGIATOR_GATE	29
+#define ADSR_DECAY			30
+#define MORPH_RATE			31	//0 plays the morphing waveshapes at their own rate, up to 255 for 256 times faster. The LFO can sweep it. (MIDI CC 33)
+#define OSC_SYNC			32	//0 to 127 the oscillators run free, 128 and up OSC_2 is hard synced to OSC_1 (MIDI CC 34)
+#define PM_AMOUNT			33	//How far OSC_1 pushes OSC_2's phase around, 0 for none, 255 for up to half a cycle each way (MIDI CC 35)
+#define SUB_LEVEL			34	//How much sub oscillator is added to the mix, 0 for none (MIDI CC 36)
+#define SUB_MODE			35	//The sub oscillator's SUB_MODE_ bits (MIDI CC 37)
+#define UNISON_VOICES		36	//0 to 63 OSC_1 plays its own waveshape, 64 and up a detuned stack of 3, 4 or 5 ramps (MIDI CC 38)
+#define UNISON_SPREAD		37	//How far the outer unison voices are detuned, 0 for none, 255 for a semitone each way (MIDI CC 39)
+#define SCAN_POSITION		38	//Where WAVETABLE_SCAN is in its bank, 0 for the first frame, 255 for the last. The LFO can sweep it. (MIDI CC 40)
+#define SCAN_ENV_AMOUNT		39	//How far the amplitude envelope pushes SCAN_POSITION up, 0 for not at all (MIDI CC 41)
+
+#define OSC_SYNC_ON			128	//OSC_SYNC at or above this turns hard sync on
+#define SUB_MODE_SIN			0x80	//Set for a sine sub oscillator, clear for a square
+#define SUB_MODE_TWO_OCTAVES	0x40	//Set for two octaves below OSC_1, clear for one
+
+//Parameter Change Tracking
+/*Each parameter has a set of consumer bits in AUC_PARAMETER_CONSUMERS, one for each routine that reads it.
+Whoever changes a parameter sets its consumers' bits in uc_changed_consumers. Each consumer clears its own bit
+when it runs, so if the bit is still clear next time, none of its inputs changed and it can skip the work.
+The table is in program memory, so files that use MARK_PARAMETER_CHANGED need <pgmspace.h>.*/
+#define CONSUMER_PITCH		0x01	//calculate_pitch()
+#define CONSUMER_LFO		0x02	//lfo()
+#define CONSUMER_FILTER		0x04	//filter()
+#define CONSUMER_AMPLITUDE	0x08	//set_amplitude()
+#define CONSUMER_ALL		0x0F
+#define MARK_PARAMETER_CHANGED(p_setting, uc_param)	((p_setting)->uc_changed_consumers |= pgm_read_byte(&AUC_PARAMETER_CONSUMERS[uc_param]))
+
+//SPI Related Constants and Macros
+#define SPI_TX_BUF_LGTH    				3
+#define CLEAR_EXT_INTERRUPTS			EIFR |= 0xFF;
+#define ENABLE_EXT_INT_0   				EIMSK |= (1 << INT0)  
+#define DISABLE_EXT_INT_0  				EIMSK &= ~(1 << INT0)
+#define ENABLE_EXT_INT_1   				EIMSK |= (1 << INT1) 
+#define DISABLE_EXT_INT_1  				EIMSK &= ~(1 << INT1)
+
+
+//Global Variables - They should always be volatile and prefixed by g_.
+//Global Flags
+extern unsigned char g_uc_output;//main output variable
+volatile unsigned char g_uc_spi_buffer;//Buffer for the Serial Peripheral Interface
+volatile unsigned char g_uc_sample_request_flag;//flag used to set the output and request a new sample from the state machine
+volatile unsigned char g_uc_slow_interrupt_flag;//flag set to tell events to update their values
+volatile unsigned char g_uc_slow_tick_count;//slow interrupts so far, so TIMER0 can time things longer than one slow tick
+volatile unsigned char g_uc_key_press_flag;//flag for when a key is pressed
+volatile unsigned char g_uc_note_on_flag;//flag for generating audio output
+volatile unsigned char g_uc_ad_ready_flag;//flag used to indicate when the AD has completed a reading
+volatile unsigned char g_uc_spi_ready_flag;//flag used to indicate that the SPI has completed transmission
+volatile unsigned char g_uc_lfo_midi_sync_flag;//This flag is used to sync events to the arrival of new note on messages.
+volatile unsigned char g_uc_filter_envelope_sync_flag;//Syncs the filter envelope to notes being played
+volatile unsigned char g_uc_oscillator_midi_sync_flag;//Syncs morphing oscillators to key press
+volatile unsigned int g_un_oscillator_frequency_osc1;
+volatile unsigned int g_un_oscillator_frequency_osc2;
+volatile unsigned char g_uc_adsr_midi_sync_flag;
+volatile unsigned char g_uc_ext_int_0_flag;//Flag indicates external interrupt 0 has been triggered
+volatile unsigned char g_uc_ext_int_1_flag;//Flag indicates external interrupt 1 has been triggered
+volatile unsigned char g_uc_drone_flag;
+
+volatile unsigned int g_un_switch_debounce_timer;//Timer used to debounce switch presses
+
+
+//Global Setting Type Declaration
+//This structure holds all the settings information for the synth. We pass this structure to functions
+//to allow them to change settings.
+typedef struct
+{	
+		
+	//oscillator variables
+	unsigned long aul_sample_reference[3];	//where we are in the cycle for each oscillator, 16.8 fixed point in the low 24 bits.
+											//Bits 8 to 23 are the phase, a full cycle is 65536 and it wraps by itself.
+											//[OSC_SUB] counts OSC_1's cycles instead, for the sub oscillator.
+	unsigned char auc_midi_note_index[NUMBER_OF_OSCILLATORS];//the midi index of the note frequency
+	unsigned long aul_phase_increment[NUMBER_OF_OSCILLATORS];//how far the sample reference moves each sample, 16.8 fixed point
+	unsigned char auc_table_note[NUMBER_OF_OSCILLATORS];//the first note at or above the increment actually playing, which picks the band limited tables
+
+	//ADSR variables
+	unsigned char uc_adsr_multiplier;	//used for the ADSR calculation
+	unsigned char uc_note_velocity;		//how hard the key was hit
+
+	//Output amplitude
+	unsigned char uc_amplitude;	//main output amplitude
+	
+	//LFO variables
+	unsigned char uc_lfo_sel;	//which LFO is active for the rate/amount pots
+	unsigned char uc_lfo_sync;
+
+		
+	//parameter storage arrays
+	unsigned char auc_ad_values[NUMBER_OF_PARAMETERS];	//array containing values from the ADC
+	unsigned char auc_synth_params[NUMBER_OF_PARAMETERS];//array of synth parameters affected by the ADC readings
+	unsigned char auc_external_params[NUMBER_OF_PARAMETERS];//array containing parameter values loaded from eeprom
+	unsigned char auc_parameter_source[NUMBER_OF_PARAMETERS];/*flag array contains the source for the synth parameters, internal or external*/
+	unsigned char uc_changed_consumers;//CONSUMER_ bits of the routines whose inputs changed since they last ran
+
+} g_setting;
+
+extern g_setting global_setting, *p_global_setting;
+extern const unsigned char AUC_PARAMETER_CONSUMERS[NUMBER_OF_PARAMETERS];
+
+#if ASM_KERNELS && ASM_KERNEL_CHECK
+extern unsigned int g_un_asm_kernel_mismatch_count;//Samples where an assembly kernel didn't match its C version
+extern unsigned char g_auc_asm_kernel_cycles[NUMBER_OF_ASM_KERNELS][2];//Worst case cycles, [kernel][0] C, [kernel][1] assembly
+#endif
+
+#endif /*SPROCKIT_MAIN_H*/
@@ -0,0 +1,134 @@
+/*
+@file stack_monitor.c
+
+@brief This module measures how deep the stack really gets.
+
+The main loop's call chain and the interrupts (timer 2, SPI, AD, uart and the two switches) can all be on the
+stack at once, so the static estimate from tools/memory_report.py is only an upper bound on paths it can see.
+At reset, before anything has been pushed, every byte from the end of .bss up to the top of RAM is painted
+with STACK_MONITOR_PAINT. The stack wipes the paint out as it grows down, and it never comes back, so the
+lowest byte that isn't paint any more is as deep as the stack has ever been.
+
+Finding it is spread out over the scheduler's slow task. Each call walks up to STACK_MONITOR_SCAN_BYTES
+bytes of paint upward from the end of .bss. A pass ends at the first byte that isn't paint, or at the
+watermark found so far, and the next pass starts from the bottom again. With the usual few hundred free bytes
+a pass takes well under a second. The scan only reads, so it doesn't matter if an interrupt comes along in the
+middle of it, whatever that interrupt wrote is found by the next pass.
+
+This file is part of Sprockit.
+
+    Sprockit is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Sprockit is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Sprockit.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#include <io.h>
+#include <sprockit_main.h>
+#include <stack_monitor.h>
+
+#define STACK_MONITOR_BOTTOM	(&__heap_start)						//First byte after .bss. There is no heap, so nothing else lives here.
+#define STACK_MONITOR_TOP		((volatile unsigned char *)RAMEND)	//Where the stack starts
+
+extern unsigned char __heap_start;	//From the linker script
+
+unsigned int g_un_stack_monitor_peak;
+unsigned int g_un_stack_monitor_free;
+
+static volatile unsigned char *p_uc_stack_monitor_cursor;		//How far up the pass in progress has got
+static volatile unsigned char *p_uc_stack_monitor_watermark;	//The deepest byte the stack has written so far
+
+void stack_monitor_paint(void) __attribute__((naked, used, section(".init1")));
+
+/*
+@brief This function paints the free RAM. It sits in .init1, so it runs straight out of reset before the stack
+pointer is even set up, and it can't use the stack or call anything. That's why it's in assembly.
+
+@param It takes no parameters.
+
+@return It doesn't return anything. Being naked, it falls through into the rest of the start up code.
+*/
+void
+stack_monitor_paint(void)
+{
+	asm volatile
+	(
+		"ldi r30, lo8(__heap_start)"	"\n\t"
+		"ldi r31, hi8(__heap_start)"	"\n\t"
+		"ldi r24, %[paint]"				"\n\t"
+		"ldi r25, hi8(%[top])"			"\n\t"
+	"1:"								"\n\t"
+		"st Z+, r24"					"\n\t"
+		"cpi r30, lo8(%[top])"			"\n\t"
+		"cpc r31, r25"					"\n\t"
+		"brlo 1b"						"\n\t"
+		"breq 1b"						"\n\t"
+		:
+		: [paint] "M" (STACK_MONITOR_PAINT),
+		  [top] "i" (RAMEND)
+		: "r24", "r25", "r30", "r31", "memory"
+	);
+}
+
+/*
+@brief This function starts the watermark at the top of RAM, so the first pass finds the stack main is on.
+
+@param It takes no parameters.
+
+@return It doesn't return anything.
+*/
+void
+stack_monitor_init(void)
+{
+	p_uc_stack_monitor_cursor = STACK_MONITOR_BOTTOM;
+	p_uc_stack_monitor_watermark = STACK_MONITOR_TOP + 1;
+	g_un_stack_monitor_peak = 0;
+	g_un_stack_monitor_free = (STACK_MONITOR_TOP + 1) - STACK_MONITOR_BOTTOM;
+}
+
+/*
+@brief This function moves the pass in progress up to STACK_MONITOR_SCAN_BYTES bytes. When the pass hits a
+byte that isn't paint below the old watermark, that byte is the new watermark and the report is updated.
+
+@param It takes no parameters.
+
+@return It doesn't return anything. The result ends up in g_un_stack_monitor_peak and g_un_stack_monitor_free.
+*/
+void
+stack_monitor_scan(void)
+{
+	volatile unsigned char *p_uc_byte = p_uc_stack_monitor_cursor;
+	volatile unsigned char *p_uc_watermark = p_uc_stack_monitor_watermark;//In registers for the loop
+	unsigned char uc_count = STACK_MONITOR_SCAN_BYTES;
+
+	/*About 14 cycles a byte: compare against the watermark, load and check the byte, step the pointer and the
+	count. With the call and the loads and stores around the loop, a call is about 480 cycles, 8 TIMER0 counts.*/
+	while(p_uc_byte < p_uc_watermark && *p_uc_byte == STACK_MONITOR_PAINT)
+	{
+		p_uc_byte++;
+
+		if(--uc_count == 0)
+		{
+			p_uc_stack_monitor_cursor = p_uc_byte;//Pick up from here next time
+			return;
+		}
+	}
+
+	//The pass is over. Anything it stopped on below the old watermark is stack that wasn't there before.
+	if(p_uc_byte < p_uc_watermark)
+	{
+		p_uc_stack_monitor_watermark = p_uc_byte;
+		g_un_stack_monitor_peak = (STACK_MONITOR_TOP + 1) - p_uc_byte;
+		g_un_stack_monitor_free = p_uc_byte - STACK_MONITOR_BOTTOM;
+	}
+
+	p_uc_stack_monitor_cursor = STACK_MONITOR_BOTTOM;
+}
@@ -0,0 +1,35 @@
+/*
+	This file is part of Sprockit.
+
+    Sprockit is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Sprockit is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Sprockit.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef STACK_MONITOR_H
+#define STACK_MONITOR_H
+
+#define STACK_MONITOR_PAINT			0xC5	//What every free byte of RAM is painted with at reset
+#define STACK_MONITOR_SCAN_BYTES	32		//Painted bytes the scan task looks at per call, about 8 TIMER0 counts
+
+//Stack report. Read these with a debugger or the simulator.
+extern unsigned int g_un_stack_monitor_peak;	//Most bytes of stack ever in use, interrupts included
+extern unsigned int g_un_stack_monitor_free;	//Bytes between the end of .bss and the deepest the stack has been. 0 means it ran into .bss.
+
+//Function prototypes
+void
+stack_monitor_init(void);
+
+void
+stack_monitor_scan(void);
+
+#endif /*STACK_MONITOR_H*/
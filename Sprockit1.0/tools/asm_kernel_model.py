@@ -0,0 +1,464 @@
+#!/usr/bin/env python3
+"""
+@file asm_kernel_model.py
+
+@brief Runs the assembly kernels from oscillator.c and audio_block.c on a model of the AVR instructions they use,
+checks them against their C references and counts their cycles.
+
+The cycles are the ones inside the asm, counted the way the table above the assembly kernels in oscillator.c
+counts them. ASM_KERNEL_CHECK does the same on the chip, this is for when there isn't one to hand. The model
+only knows the instructions the modelled kernels use, and stops on any other. Each kernel is checked against a
+Python copy of its C version, and has to leave __zero_reg__ at 0.
+
+It reads the kernels and the tables out of the working tree, or out of git at --at, so the old full row square
+kernel can be run next to the new one. Kernels that aren't at the revision are skipped:
+
+	python3 tools/asm_kernel_model.py
+	python3 tools/asm_kernel_model.py --at 24410e3
+
+This file is part of Sprockit.
+
+    Sprockit is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Sprockit is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Sprockit.  If not, see <http://www.gnu.org/licenses/>
+"""
+
+import argparse
+import functools
+import os
+import random
+import re
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import half_bank_check
+
+ROW_ADDRESS = 0x1F80		#Where a row goes in flash, so it runs over a 256 byte page
+LUT_ADDRESS = 0x00E0		#Where the sine quarter wave goes, so it runs over one too
+VOICE_ADDRESS = 0x01FC		#Where the unison voices go in RAM, so X runs over a page
+RANDOM_ROWS = 200			#Rows of noise checked as well as the ramp bank, so no value is left out
+RANDOM_QUARTERS = 20		#Quarter waves of noise, so the interpolation sees big steps both ways
+RANDOM_CASES = 50000		#Random inputs for the mix/filter
+UNISON_CASES = 3000		#Random voices for the unison, spread over 3 to 5 voices
+
+
+def assembly(source, function):
+	"""The kernel's instructions and the names of its operands."""
+	start = source.index('\n' + function + '(')
+	start = source.index('__asm__', start)
+	end = source.index(');', start)
+	lines = re.findall(r'"((?:[^"\\]|\\.)*)"\s*"\\n\\t"', source[start:end])
+	operands = re.findall(r'\[(\w+)\]\s*"', source[start:end])
+	return lines, operands
+
+def parse(lines):
+	"""The instructions split into the op and its operands, and where each numeric label is."""
+	program = []
+	labels = {}
+	for line in lines:
+		line = line.strip()
+		match = re.match(r'(\d+):\s*(.*)', line)
+		if match:
+			labels.setdefault(match.group(1), []).append(len(program))
+			line = match.group(2)
+		if line:
+			op, _, rest = line.partition(' ')
+			program.append((op, [arg.strip() for arg in rest.split(',')] if rest else []))
+	return program, labels
+
+@functools.lru_cache(maxsize=None)
+def operand(text):
+	"""Which byte of which operand, 'A', 'B' or '' for all of it."""
+	return re.match(r'%([AB]?)\[(\w+)\]', text.strip()).groups()
+
+@functools.lru_cache(maxsize=None)
+def pointer(text):
+	"""The pointer operand's name and whether it's post incremented."""
+	match = re.match(r'%a\[(\w+)\](\+?)', text.strip())
+	return match.group(1), match.group(2) == '+'
+
+def run(program, labels, registers, flash, ram=None):
+	"""Runs the kernel, returns the operands it leaves, with r0 and r1, and the cycles it took. ram is changed in place."""
+	registers = dict(registers, r0=0, r1=0)
+	carry = 0
+	zero = 0
+	negative = 0
+	cycles = 0
+	pc = 0
+
+	def get(text):
+		text = text.strip()
+		if text == '__zero_reg__':
+			text = 'r1'
+		if text in ('r0', 'r1'):
+			return registers[text]
+		if not text.startswith('%'):
+			return int(text, 0) & 0xFF
+		part, name = operand(text)
+		value = registers[name]
+		return value & 0xFF if part == 'A' else (value >> 8) & 0xFF if part == 'B' else value
+
+	def put(text, value):
+		text = text.strip()
+		if text == '__zero_reg__':
+			text = 'r1'
+		if text in ('r0', 'r1'):
+			registers[text] = value & 0xFF
+			return
+		part, name = operand(text)
+		if part == 'A':
+			registers[name] = (registers[name] & 0xFF00) | (value & 0xFF)
+		elif part == 'B':
+			registers[name] = (registers[name] & 0xFF) | ((value & 0xFF) << 8)
+		else:
+			registers[name] = value
+
+	def target(label):
+		places = labels[label[:-1]]
+		if label[-1] == 'f':
+			return min(place for place in places if place > pc)
+		return max(place for place in places if place <= pc)
+
+	while pc < len(program):
+		op, args = program[pc]
+		next_pc = pc + 1
+		took = 1
+
+		if op == 'mov':
+			put(args[0], get(args[1]))
+		elif op == 'movw':
+			put(args[0], registers['r0'] | (registers['r1'] << 8) if args[1] == 'r0' else registers[operand(args[1])[1]])
+		elif op == 'ldi':
+			half = re.match(r'(lo8|hi8)\(%\[(\w+)\]\)', args[1])
+			if half:
+				value = registers[half.group(2)]
+				put(args[0], value & 0xFF if half.group(1) == 'lo8' else (value >> 8) & 0xFF)
+			else:
+				put(args[0], get(args[1]))
+		elif op in ('sub', 'subi', 'sbc', 'sbci', 'cpi'):
+			borrow = carry if op in ('sbc', 'sbci') else 0
+			result = get(args[0]) - get(args[1]) - borrow
+			carry = 1 if result < 0 else 0
+			result &= 0xFF
+			zero = result == 0 and (zero or op not in ('sbc', 'sbci'))	#sbc only ever clears Z
+			negative = result >> 7
+			if op != 'cpi':
+				put(args[0], result)
+		elif op in ('add', 'adc'):
+			result = get(args[0]) + get(args[1]) + (carry if op == 'adc' else 0)
+			carry = result >> 8
+			result &= 0xFF
+			zero = result == 0
+			negative = result >> 7
+			put(args[0], result)
+		elif op in ('andi', 'inc', 'dec', 'com', 'neg', 'clr', 'tst'):
+			value = get(args[0])
+			result = {'andi': lambda: value & get(args[1]), 'inc': lambda: value + 1, 'dec': lambda: value - 1,
+					  'com': lambda: ~value, 'neg': lambda: -value, 'clr': lambda: 0, 'tst': lambda: value}[op]() & 0xFF
+			if op in ('com', 'neg'):
+				carry = 1 if op == 'com' or result else 0
+			zero = result == 0
+			negative = result >> 7
+			if op != 'tst':
+				put(args[0], result)
+		elif op in ('lsr', 'ror', 'asr'):
+			value = get(args[0])
+			result = (value >> 1) | {'lsr': 0, 'ror': carry << 7, 'asr': value & 0x80}[op]
+			carry = value & 1
+			zero = result == 0
+			negative = result >> 7
+			put(args[0], result)
+		elif op in ('mul', 'mulsu'):
+			first = get(args[0])
+			if op == 'mulsu' and first & 0x80:
+				first -= 256
+			result = (first * get(args[1])) & 0xFFFF
+			registers['r0'] = result & 0xFF
+			registers['r1'] = result >> 8
+			carry = result >> 15
+			zero = result == 0
+			took = 2
+		elif op == 'adiw':
+			name = operand(args[0])[1]
+			registers[name] = (registers[name] + int(args[1])) & 0xFFFF
+			took = 2
+		elif op == 'lpm':
+			put(args[0], flash[registers[pointer(args[1])[0]]])
+			took = 3
+		elif op in ('ld', 'st'):
+			name, increment = pointer(args[1] if op == 'ld' else args[0])
+			if op == 'ld':
+				put(args[0], ram[registers[name]])
+			else:
+				ram[registers[name]] = get(args[1])
+			if increment:
+				registers[name] = (registers[name] + 1) & 0xFFFF
+			took = 2
+		elif op == 'rjmp':
+			next_pc = target(args[0])
+			took = 2
+		elif op in ('brcs', 'brlo', 'brcc', 'brsh', 'breq', 'brne', 'brmi', 'brpl'):
+			if {'brcs': carry, 'brlo': carry, 'brcc': not carry, 'brsh': not carry, 'breq': zero, 'brne': not zero,
+				'brmi': negative, 'brpl': not negative}[op]:
+				next_pc = target(args[0])
+				took = 2
+		elif op in ('sbrc', 'sbrs'):
+			if ((get(args[0]) >> int(args[1])) & 1) == (op == 'sbrs'):
+				next_pc = pc + 2
+				took = 2
+		else:
+			sys.exit('the model has no %s, in: %s %s' % (op, op, ', '.join(args)))
+
+		cycles += took
+		pc = next_pc
+
+	return registers, cycles
+
+def sample(row, index):
+	"""A sample out of a whole row, or out of a half one the way wavetable_half() reads it."""
+	if len(row) == half_bank_check.SAMPLES:
+		return row[index]
+	fold = (index + 1) & 0xFF
+	return 255 - row[-fold & 0xFF] if index & 0x80 else row[fold]
+
+def quarter(table, index):
+	"""wavetable_quarter()"""
+	fold = (index + 1) & 0x7F
+	if fold > 64:
+		fold = 128 - fold
+	return 255 - table[fold] if index & 0x80 else table[fold]
+
+def sin(table, phase):
+	"""oscillator_kernel_sin(), with linear_interpolate()"""
+	first = quarter(table, phase >> 8)
+	second = quarter(table, ((phase >> 8) + 1) & 0xFF)
+	return (first + (((second - first) * ((phase >> 1) & 0x7F)) >> 8)) & 0xFF
+
+def blend(first, second, weight_1, weight_2, index):
+	"""oscillator_kernel_blend() on whole rows, oscillator_kernel_half() on half ones"""
+	return ((sample(first, index) * weight_1 + sample(second, index) * weight_2) & 0xFFFF) >> 8
+
+def square(row, index):
+	"""oscillator_kernel_square()"""
+	difference = sample(row, index) - sample(row, (index - 127) & 0xFF)
+	return 255 if difference > 127 else 0 if difference < -128 else 128 + difference
+
+def signed(value):
+	return value - 256 if value & 0x80 else value
+
+def mix_filter(osc_1, osc_2, osc_1_level, osc_2_level, sub, sub_level, last):
+	"""audio_block_mix_filter()"""
+	mix = ((osc_1 * osc_1_level + osc_2 * osc_2_level) & 0xFFFF) >> 8
+	mix += (signed(sub ^ 0x80) * sub_level) >> 8
+	mix = min(max(mix, 0), 255)
+	return (((mix - last) >> 2) + last) & 0xFF
+
+def phase_mod(phase, sample_value, amount):
+	"""audio_block_phase_mod()"""
+	return (phase + signed(sample_value ^ 0x80) * amount) & 0xFFFF
+
+def unison(voices, row, gain):
+	"""audio_block_unison(), the sample and the phases it leaves"""
+	total = 0
+	phases = []
+	for increment, phase in voices:
+		phase = (phase + increment) & 0xFFFFFFFF
+		total += sample(row, (phase >> 16) & 0xFF)
+		phases.append(phase)
+	return ((total * gain) & 0xFFFF) >> 8, phases
+
+def in_flash(row, address=ROW_ADDRESS):
+	return {address + offset: value for offset, value in enumerate(row)}
+
+def sin_cases(tables, noise):
+	"""Every index and fraction on the sine quarter wave, every index at a few fractions on the noise."""
+	lut = tables['G_AUC_SIN_QUARTER_LUT']
+	every = [(index << 8) | (fraction << 1) for index in range(256) for fraction in range(128)]
+	some = [(index << 8) | (fraction << 1) for index in range(256) for fraction in (0, 1, 32, 63, 64, 96, 127)]
+	quarters = [(lut, every)] + [([noise.randrange(256) for _ in lut], some) for _ in range(RANDOM_QUARTERS)]
+	cases = []
+	for table, phases in quarters:
+		flash = in_flash(table, LUT_ADDRESS)
+		cases += [({'phase': phase, 'lut': LUT_ADDRESS}, flash, None, sin(table, phase)) for phase in phases]
+	return 'every phase on the sine and %d quarter waves of noise' % RANDOM_QUARTERS, cases
+
+def weighed_cases(rows, weights):
+	cases = []
+	for first, second in zip(rows, rows[1:] + rows[:1]):
+		flash = {**in_flash(first), **in_flash(second, ROW_ADDRESS + 0x200)}
+		for weight_1, weight_2 in weights:
+			cases += [({'phase': (index << 8) | 0x5A, 'row_1': ROW_ADDRESS, 'row_2': ROW_ADDRESS + 0x200,
+						'weight_1': weight_1, 'weight_2': weight_2}, flash, None, blend(first, second, weight_1, weight_2, index))
+					  for index in range(256)]
+	return cases
+
+def blend_cases(tables, noise):
+	"""Neighbouring scan frames and rows of noise at the weights oscillator_plan_scan() gives, every 32nd fade."""
+	rows = tables['G_AUC_SCAN_WAVETABLE_LUT'] + [[noise.randrange(256) for _ in range(256)] for _ in range(8)]
+	weights = [(128, 128)] + [(256 - fade, fade) for fade in list(range(1, 256, 32)) + [255]]
+	return '%d frames and rows of noise at %d weights' % (len(rows), len(weights)), weighed_cases(rows, weights)
+
+def half_cases(tables, noise):
+	"""Neighbouring ramp rows and rows of noise at the two weights the plan gives."""
+	ramp = tables['G_AUC_RAMP_WAVETABLE_LUT']
+	rows = ramp + [[noise.randrange(256) for _ in ramp[0]] for _ in range(RANDOM_ROWS)]
+	return '%d half cycle rows at 128/128 and 192/64' % len(rows), weighed_cases(rows, [(128, 128), (192, 64)])
+
+def square_cases(tables, noise):
+	"""Every phase on the ramp rows and rows of noise."""
+	ramp = tables['G_AUC_RAMP_WAVETABLE_LUT']
+	rows = ramp + [[noise.randrange(256) for _ in ramp[0]] for _ in range(RANDOM_ROWS)]
+	cases = []
+	for row in rows:
+		flash = in_flash(row)
+		cases += [({'phase': (index << 8) | 0x5A, 'row': ROW_ADDRESS}, flash, None, square(row, index)) for index in range(256)]
+	return '%d %s rows' % (len(rows), 'whole' if len(ramp[0]) == half_bank_check.SAMPLES else 'half cycle'), cases
+
+def mix_filter_cases(tables, noise):
+	"""Random inputs, half of them out of the ends of the range where the clipping is."""
+	ends = [0, 1, 2, 126, 127, 128, 129, 253, 254, 255]
+	def byte():
+		return noise.choice(ends) if noise.randrange(2) else noise.randrange(256)
+	cases = []
+	for _ in range(RANDOM_CASES):
+		inputs = dict(zip(['osc_1', 'osc_2', 'osc_1_level', 'osc_2_level', 'sub', 'sub_level', 'last'], [byte() for _ in range(7)]))
+		cases.append((inputs, {}, None, mix_filter(**inputs)))
+	return '%d random inputs' % RANDOM_CASES, cases
+
+def phase_mod_cases(tables, noise):
+	"""Every sample and amount, each on a random phase."""
+	cases = []
+	for sample_value in range(256):
+		for amount in range(256):
+			phase = noise.randrange(65536)
+			cases.append(({'phase': phase, 'sample': sample_value, 'amount': amount}, {}, None, phase_mod(phase, sample_value, amount)))
+	return 'every sample and amount', cases
+
+def unison_cases(tables, noise):
+	"""Random increments and phases for 3 to 5 voices on the ramp rows, at the gain AUC_UNISON_GAIN_LUT gives them."""
+	ramp = tables['G_AUC_RAMP_WAVETABLE_LUT']
+	gains = tables['AUC_UNISON_GAIN_LUT']
+	cases = []
+	for case in range(UNISON_CASES):
+		row = ramp[case % len(ramp)]
+		count = 3 + case % len(gains)
+		voices = [(noise.randrange(1 << 24), noise.randrange(1 << 32)) for _ in range(count)]
+		ram = {}
+		for voice, (increment, phase) in enumerate(voices):
+			for byte in range(4):
+				ram[VOICE_ADDRESS + voice * 8 + byte] = (increment >> (byte * 8)) & 0xFF
+				ram[VOICE_ADDRESS + voice * 8 + 4 + byte] = (phase >> (byte * 8)) & 0xFF
+		result, phases = unison(voices, row, gains[count - 3])
+		cases.append(({'voice': VOICE_ADDRESS, 'voices': count, 'row': ROW_ADDRESS, 'gain': gains[count - 3]},
+					  in_flash(row), ram, (result, [phase & 0xFFFFFF for phase in phases])))
+	return '%d sums of 3 to 5 voices' % UNISON_CASES, cases
+
+def unison_output(registers, ram):
+	"""The sample and the bottom 3 bytes of each voice's phase, all the assembly keeps up."""
+	phases = []
+	address = VOICE_ADDRESS + 4
+	while address in ram:
+		phases.append(ram[address] | (ram[address + 1] << 8) | (ram[address + 2] << 16))
+		address += 8
+	return registers['temp'], phases
+
+#name: the file and function of the kernel, its cases and what it leaves the sample in
+KERNELS = {
+	'sin':			('oscillator.c', 'oscillator_kernel_sin_asm', sin_cases, lambda registers, ram: registers['result']),
+	'blend':		('oscillator.c', 'oscillator_kernel_blend_asm', blend_cases, lambda registers, ram: registers['calc'] >> 8),
+	'half':			('oscillator.c', 'oscillator_kernel_half_asm', half_cases, lambda registers, ram: registers['calc'] >> 8),
+	'square':		('oscillator.c', 'oscillator_kernel_square_asm', square_cases, lambda registers, ram: registers['result']),
+	'mix/filter':	('audio_block.c', 'audio_block_mix_filter_asm', mix_filter_cases, lambda registers, ram: registers['last']),
+	'phase mod':	('audio_block.c', 'audio_block_phase_mod_asm', phase_mod_cases, lambda registers, ram: registers['phase']),
+	'unison':		('audio_block.c', 'audio_block_unison_asm', unison_cases, unison_output),
+}
+
+#Table: the files it's looked for in, in order
+TABLES = {
+	'G_AUC_SIN_QUARTER_LUT': ['wavetables.c'],
+	'G_AUC_SCAN_WAVETABLE_LUT': ['wavetable_banks.c', 'wavetables.c'],
+	'AUC_UNISON_GAIN_LUT': ['audio_block.c'],
+}
+
+def read(revision, path):
+	"""A file from the working tree or the revision, '' if it isn't there."""
+	if revision:
+		if path not in half_bank_check.git('ls-tree', '--name-only', revision, '.').split():
+			return ''
+		text = half_bank_check.git('show', '%s:./%s' % (revision, path))
+	else:
+		with open(os.path.join(half_bank_check.host_check.FIRMWARE, path)) as source:
+			text = source.read()
+	return text.replace('\r', '')
+
+def table(source, name):
+	"""The numbers in the table, a row of 256 at a time if it has more, None if it isn't there."""
+	match = re.search(r'\b%s\s*(?:\[[^]]*\]\s*)+[^=;]*=\s*\{(.*?)\};' % re.escape(name), source, re.S)
+	if match is None:
+		return None
+	numbers = [int(number) for number in re.findall(r'\d+', match.group(1))]
+	if len(numbers) > half_bank_check.SAMPLES:
+		return [numbers[row:row + half_bank_check.SAMPLES] for row in range(0, len(numbers), half_bank_check.SAMPLES)]
+	return numbers
+
+def sources(revision):
+	"""The kernels' files and the tables they read, from the working tree or the revision."""
+	files = {path: read(revision, path) for path in ('oscillator.c', 'audio_block.c')}
+	tables = {}
+	for name, paths in TABLES.items():
+		found = [table(read(revision, path), name) for path in paths]
+		tables[name] = next((rows for rows in found if rows is not None), None)
+	if revision:
+		banks = (half_bank_check.committed(revision, ['wavetable_banks.c', 'wavetables.c'], half_bank_check.HALF_SIZE)
+				 or half_bank_check.committed(revision, ['wavetables.c'], half_bank_check.SAMPLES))
+	else:
+		banks = {'G_AUC_RAMP_WAVETABLE_LUT': half_bank_check.rows(read(None, 'wavetable_banks.c'), 'G_AUC_RAMP_WAVETABLE_LUT')}
+	if banks is None:
+		sys.exit('no ramp bank at ' + revision)
+	tables['G_AUC_RAMP_WAVETABLE_LUT'] = banks['G_AUC_RAMP_WAVETABLE_LUT']
+	return files, tables
+
+def main():
+	parser = argparse.ArgumentParser(description='Run the assembly kernels on a model of the AVR and count their cycles.')
+	parser.add_argument('--at', metavar='REVISION', help='take the kernels and the tables from this revision')
+	args = parser.parse_args()
+
+	files, tables = sources(args.at)
+	failed = False
+
+	for name, (path, function, cases, output) in KERNELS.items():
+		if '\n' + function + '(' not in files[path]:
+			print('%s: not in %s' % (name, path))
+			continue
+		lines, operands = assembly(files[path], function)
+		program, labels = parse(lines)
+		what, checks = cases(tables, random.Random(1))
+		mismatches = 0
+		fewest = None
+		most = 0
+
+		for inputs, flash, ram, expected in checks:
+			registers = dict.fromkeys(operands, 0)
+			registers.update(inputs)
+			registers, cycles = run(program, labels, registers, flash, ram)
+			if output(registers, ram) != expected or registers['r1'] != 0:
+				mismatches += 1
+			fewest = cycles if fewest is None else min(fewest, cycles)
+			most = max(most, cycles)
+
+		print('%s: %d mismatches over %s, %d to %d cycles' % (name, mismatches, what, fewest, most), flush=True)
+		failed = failed or mismatches != 0
+
+	return 1 if failed else 0
+
+if __name__ == '__main__':
+	sys.exit(main())
@@ -0,0 +1,151 @@
+#!/usr/bin/env python3
+"""
+@file half_bank_check.py
+
+@brief Checks that the ramp and triangle banks, stored as half cycles, play exactly the whole cycles they were
+folded from.
+
+The whole cycles are written out as a C file and linked into tools/host/half_bank_check.c, which reads every
+sample through the accessors and runs the half and square kernels against them. See tools/host_check.py for how
+the host checks are built.
+
+By default the banks are the ones in wavetable_banks.c and the whole cycles are the ones tools/wavetable_gen.py
+synthesizes before folding them. With --against, the banks are the ones committed at that revision and the whole
+cycles are the pasted full rows from the newest wavetables.c before it that still had them. The commit that first
+halved the banks is checked this way:
+
+	python3 tools/half_bank_check.py
+	python3 tools/half_bank_check.py --against 5993697
+
+This file is part of Sprockit.
+
+    Sprockit is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Sprockit is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Sprockit.  If not, see <http://www.gnu.org/licenses/>
+"""
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import host_check
+import wavetable_gen
+
+ROWS = wavetable_gen.ROWS
+SAMPLES = wavetable_gen.SAMPLES
+HALF_SIZE = wavetable_gen.HALF_SIZE
+
+#Bank: name the check links the whole cycles as
+BANKS = {
+	'G_AUC_RAMP_WAVETABLE_LUT': 'REFERENCE_RAMP',
+	'G_AUC_TRIANGLE_WAVETABLE_LUT': 'REFERENCE_TRIANGLE',
+}
+GENERATED = {'G_AUC_RAMP_WAVETABLE_LUT': 'ramp', 'G_AUC_TRIANGLE_WAVETABLE_LUT': 'triangle'}
+
+ARRAY = r'(%s\s*\[[^]]*\]\s*\[[^]]*\][^=]*=\s*\{)(.*?)(\};)'
+
+
+def git(*args):
+	result = subprocess.run(['git'] + list(args), cwd=host_check.FIRMWARE, capture_output=True, text=True)
+	if result.returncode != 0:
+		sys.exit(result.stderr.strip())
+	return result.stdout
+
+def rows(source, name):
+	"""The bank's rows in this source, None if it isn't there."""
+	match = re.search(ARRAY % re.escape(name), source, re.S)
+	if match is None:
+		return None
+	samples = [int(number) for number in re.findall(r'\d+', match.group(2))]
+	if len(samples) % ROWS != 0:
+		sys.exit('%s has %d samples, not %d rows' % (name, len(samples), ROWS))
+	size = len(samples) // ROWS
+	return [samples[row * size:(row + 1) * size] for row in range(ROWS)]
+
+def committed(revision, paths, size):
+	"""The ramp and triangle banks with rows of this size from the first of the paths at the revision that has them."""
+	for path in paths:
+		source = git('show', '%s:./%s' % (revision, path)) if path in git('ls-tree', '--name-only', revision, '.').split() else ''
+		banks = {name: rows(source, name) for name in BANKS}
+		if all(bank is not None and len(bank[0]) == size for bank in banks.values()):
+			return banks
+	return None
+
+def generated():
+	"""What tools/wavetable_gen.py synthesizes for the ramp and triangle banks before it folds them."""
+	sample_rate = wavetable_gen.read_sample_rate()
+	cycles = {}
+	for name, bank in GENERATED.items():
+		_, spectrum, highest, half, _, _ = wavetable_gen.NOTE_BANKS[bank]
+		cycles[name] = wavetable_gen.note_cycles(spectrum, highest, half, sample_rate, wavetable_gen.NOTES_PER_ROW)
+	return cycles
+
+def against(revision):
+	"""The half banks committed at the revision and the pasted full rows from before it."""
+	half = committed(revision, ['wavetable_banks.c', 'wavetables.c'], HALF_SIZE)
+	if half is None:
+		sys.exit('%s has no half cycle ramp and triangle banks' % revision)
+	for earlier in git('log', '--format=%H', revision + '^', '--', 'wavetables.c').split():
+		full = committed(earlier, ['wavetables.c'], SAMPLES)
+		if full is not None:
+			return earlier, half, full
+	sys.exit('no wavetables.c before %s has full cycle ramp and triangle banks' % revision)
+
+def write_reference(path, cycles):
+	with open(path, 'w') as out:
+		for name, reference_name in BANKS.items():
+			out.write('const unsigned char %s[%d][%d] = {\n' % (reference_name, ROWS, SAMPLES))
+			for row in cycles[name]:
+				out.write('{' + ','.join(str(sample) for sample in row) + '},\n')
+			out.write('};\n')
+
+def write_banks(path, half):
+	"""wavetable_banks.c with the ramp and triangle rows swapped for these."""
+	with open(os.path.join(host_check.FIRMWARE, 'wavetable_banks.c')) as source:
+		text = source.read()
+	for name, bank in half.items():
+		body = '\n' + '\n'.join('{' + ','.join(str(sample) for sample in row) + ',},' for row in bank) + '\n'
+		text = re.sub(ARRAY % re.escape(name), lambda match: match.group(1) + body + match.group(3), text, count=1, flags=re.S)
+	with open(path, 'w') as out:
+		out.write(text)
+
+def main():
+	parser = argparse.ArgumentParser(description='Check the half cycle banks against the whole cycles they were folded from.')
+	parser.add_argument('--against', metavar='REVISION', help='check the banks committed at this revision against the pasted full rows before it')
+	parser.add_argument('--cc', default='cc', help='the host C compiler')
+	args = parser.parse_args()
+
+	with tempfile.TemporaryDirectory() as directory:
+		modules = list(host_check.OSCILLATOR)
+		if args.against:
+			earlier, half, cycles = against(args.against)
+			print('== half_bank_check, the banks at %s against the full rows at %s' % (args.against, earlier[:12]), flush=True)
+			banks = os.path.join(directory, 'wavetable_banks.c')
+			write_banks(banks, half)
+			modules[modules.index('wavetable_banks.c')] = banks
+		else:
+			cycles = generated()
+			print('== half_bank_check, wavetable_banks.c against tools/wavetable_gen.py', flush=True)
+
+		reference = os.path.join(directory, 'half_bank_reference.c')
+		write_reference(reference, cycles)
+		program = host_check.build(args.cc, 'half_bank_check', modules + [reference], directory)
+		if program is None:
+			return 1
+		return subprocess.run([program], cwd=host_check.FIRMWARE).returncode
+
+if __name__ == '__main__':
+	sys.exit(main())
@@ -0,0 +1,143 @@
+/*
+@file half_bank_check.c
+
+@brief Host check that the ramp and triangle banks, stored as half cycles, play exactly the full cycle rows they
+replaced.
+
+Every sample of every row read through wavetable_ramp() and wavetable_triangle() has to match the full row. Then
+the half and square render plan kernels are run at every note and phase against the same blend and square worked
+out on the full rows, with the rows and weights the plan picked. It covers the C kernels, so build it with
+ASM_KERNELS at 0. The assembly kernels are held to the C ones on the chip by ASM_KERNEL_CHECK.
+
+The full rows are REFERENCE_RAMP and REFERENCE_TRIANGLE. tools/half_bank_check.py takes them out of the
+wavetables.c from before the banks were halved, links them in and runs this.
+
+This file is part of Sprockit.
+
+    Sprockit is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Sprockit is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Sprockit.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#include <stdio.h>
+#include <sprockit_main.h>
+#include <wavetables.h>
+#include <oscillator.h>
+
+#define CHECK_REPORTS		8		//Mismatches printed before it stops saying
+
+extern const unsigned char REFERENCE_RAMP[WAVETABLE_BANK_ROWS][256];
+extern const unsigned char REFERENCE_TRIANGLE[WAVETABLE_BANK_ROWS][256];
+
+g_setting global_setting, *p_global_setting = &global_setting;
+
+static unsigned long ul_mismatches = 0;
+
+/*
+@brief Counts a mismatch and prints the first few.
+
+@param It takes what was being checked, the note or row, the phase or sample index, what it should be and what it was.
+
+@return It doesn't return anything.
+*/
+static void
+check(const char *p_c_what, unsigned int un_row, unsigned long ul_index, unsigned char uc_expected, unsigned char uc_result)
+{
+	if(uc_result != uc_expected && ul_mismatches++ < CHECK_REPORTS)
+	{
+		printf("%s %u at %lu: full row %u, half row %u\n", p_c_what, un_row, ul_index, uc_expected, uc_result);
+	}
+}
+
+/*
+@brief Finds the full row a plan's half row pointer stands for.
+
+@param It takes the half row pointer, the half bank it points into and the full bank.
+
+@return It returns the full row.
+*/
+static const unsigned char *
+reference_row(const unsigned char *p_uc_half, const unsigned char (*p_bank)[WAVETABLE_HALF_SIZE], const unsigned char (*p_reference)[256])
+{
+	return p_reference[(p_uc_half - &p_bank[0][0]) / WAVETABLE_HALF_SIZE];
+}
+
+int
+main(void)
+{
+	static const unsigned char AUC_WAVESHAPES[] = {RAMP, TRIANGLE, SQUARE};
+	OSCILLATOR_PLAN st_plan;
+	const unsigned char (*p_bank)[WAVETABLE_HALF_SIZE];
+	const unsigned char (*p_reference)[256];
+	const unsigned char *p_uc_row_1;
+	const unsigned char *p_uc_row_2;
+	unsigned char uc_waveshape;
+	unsigned char uc_row;
+	unsigned char uc_note;
+	unsigned char uc_index;
+	unsigned char uc_back;
+	unsigned char uc_expected;
+	unsigned int un_index;
+	unsigned long ul_phase;
+	signed int sn_difference;
+
+	//Every sample, through the accessors
+	for(uc_row = 0; uc_row < WAVETABLE_BANK_ROWS; uc_row++)
+	{
+		for(un_index = 0; un_index < 256; un_index++)
+		{
+			check("ramp row", uc_row, un_index, REFERENCE_RAMP[uc_row][un_index], wavetable_ramp(uc_row, un_index));
+			check("triangle row", uc_row, un_index, REFERENCE_TRIANGLE[uc_row][un_index], wavetable_triangle(uc_row, un_index));
+		}
+	}
+
+	//The kernels that read the half rows, on the rows and weights each plan picked
+	initialize_oscillators();
+
+	for(un_index = 0; un_index < sizeof(AUC_WAVESHAPES); un_index++)
+	{
+		uc_waveshape = AUC_WAVESHAPES[un_index];
+		p_bank = (TRIANGLE == uc_waveshape) ? G_AUC_TRIANGLE_WAVETABLE_LUT : G_AUC_RAMP_WAVETABLE_LUT;
+		p_reference = (TRIANGLE == uc_waveshape) ? REFERENCE_TRIANGLE : REFERENCE_RAMP;
+
+		for(uc_note = 0; uc_note < 128; uc_note++)
+		{
+			st_plan.uc_waveshape = OSCILLATOR_PLAN_STALE;
+			oscillator_plan_update(&st_plan, uc_waveshape, uc_note, 0);
+			p_uc_row_1 = reference_row(st_plan.p_uc_row_1, p_bank, p_reference);
+			p_uc_row_2 = reference_row(st_plan.p_uc_row_2, p_bank, p_reference);
+
+			for(ul_phase = 0; ul_phase < 0x10000UL; ul_phase += 256)//The rows only look at the top byte
+			{
+				uc_index = ul_phase >> 8;
+
+				if(SQUARE == uc_waveshape)
+				{
+					uc_back = uc_index - 127;
+					sn_difference = p_uc_row_1[uc_index] - p_uc_row_1[uc_back];
+					uc_expected = (sn_difference > 127) ? 255 : (sn_difference < -128) ? 0 : 128 + sn_difference;
+				}
+				else
+				{
+					uc_expected = (p_uc_row_1[uc_index] * st_plan.uc_weight_1 + p_uc_row_2[uc_index] * st_plan.uc_weight_2) >> 8;
+				}
+
+				check((SQUARE == uc_waveshape) ? "square note" : (RAMP == uc_waveshape) ? "ramp note" : "triangle note",
+					  uc_note, ul_phase, uc_expected, st_plan.pf_kernel(&st_plan, &g_ast_oscillator_state[OSCILLATOR_1], ul_phase));
+			}
+		}
+	}
+
+	printf("half banks: %lu mismatches over %u rows of both banks and the half and square kernels at every note\n",
+		   ul_mismatches, WAVETABLE_BANK_ROWS);
+	return ul_mismatches != 0;
+}
@@ -0,0 +1,33 @@
+/*
+@file host_registers.c
+
+@brief Defines the registers host stand-in io.h declares, and the program memory helpers pgmspace.h can't do
+as macros.
+
+This file is part of Sprockit.
+
+    Sprockit is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Sprockit is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Sprockit.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#include <string.h>
+
+#define HOST_REGISTER(name)	volatile unsigned char name
+#include <io.h>
+#include <pgmspace.h>
+
+void *
+memcpy_P(void *p_destination, const void *p_source, size_t size)
+{
+	return memcpy(p_destination, p_source, size);
+}
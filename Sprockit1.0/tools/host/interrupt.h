@@ -0,0 +1,35 @@
+/*
+@file interrupt.h
+
+@brief Host stand-in for <avr/interrupt.h>. Interrupt handlers become ordinary functions a harness can call.
+
+This file is part of Sprockit.
+
+    Sprockit is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Sprockit is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Sprockit.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef HOST_INTERRUPT_H
+#define HOST_INTERRUPT_H
+
+#include <io.h>
+
+#define ISR(vector, ...)	void vector(void)
+#define ISR_NAKED
+#define ISR_BLOCK
+#define ISR_NOBLOCK
+#define sei()
+#define cli()
+#define reti()
+
+#endif /*HOST_INTERRUPT_H*/
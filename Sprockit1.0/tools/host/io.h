@@ -0,0 +1,130 @@
+/*
+@file io.h
+
+@brief Host stand-in for <avr/io.h>, so the firmware modules can be built with the host compiler by the
+checks in tools/host_check.py. Put tools/host ahead of the firmware directory on the include path.
+
+Every register is a plain variable, defined in host_registers.c. Nothing behind them is simulated. A harness
+sets the ones its code under test reads.
+
+This file is part of Sprockit.
+
+    Sprockit is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Sprockit is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Sprockit.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef HOST_IO_H
+#define HOST_IO_H
+
+#ifndef HOST_REGISTER
+#define HOST_REGISTER(name)	extern volatile unsigned char name
+#endif
+
+HOST_REGISTER(PRR);
+HOST_REGISTER(UCSR0A);
+HOST_REGISTER(UCSR0B);
+HOST_REGISTER(UCSR0C);
+HOST_REGISTER(UBRR0L);
+HOST_REGISTER(UBRR0H);
+HOST_REGISTER(UDR0);
+HOST_REGISTER(OCR1AL);
+HOST_REGISTER(OCR1AH);
+HOST_REGISTER(OCR1BL);
+HOST_REGISTER(OCR1BH);
+HOST_REGISTER(DDRB);
+HOST_REGISTER(DDRC);
+HOST_REGISTER(DDRD);
+HOST_REGISTER(PORTB);
+HOST_REGISTER(PORTC);
+HOST_REGISTER(PORTD);
+HOST_REGISTER(PINB);
+HOST_REGISTER(PINC);
+HOST_REGISTER(PIND);
+HOST_REGISTER(EIMSK);
+HOST_REGISTER(EICRA);
+HOST_REGISTER(EIFR);
+HOST_REGISTER(TCCR0A);
+HOST_REGISTER(TCCR0B);
+HOST_REGISTER(OCR0A);
+HOST_REGISTER(TIMSK0);
+HOST_REGISTER(TCNT0);
+HOST_REGISTER(TIFR0);
+HOST_REGISTER(TCCR1A);
+HOST_REGISTER(TCCR1B);
+HOST_REGISTER(TCNT1L);
+HOST_REGISTER(TIFR1);
+HOST_REGISTER(TCCR2A);
+HOST_REGISTER(TCCR2B);
+HOST_REGISTER(OCR2A);
+HOST_REGISTER(TIMSK2);
+HOST_REGISTER(TCNT2);
+HOST_REGISTER(TIFR2);
+HOST_REGISTER(ADMUX);
+HOST_REGISTER(ADCSRA);
+HOST_REGISTER(ADCH);
+HOST_REGISTER(ADCL);
+HOST_REGISTER(SPCR);
+HOST_REGISTER(SPSR);
+HOST_REGISTER(SPDR);
+HOST_REGISTER(MCUSR);
+HOST_REGISTER(SREG);
+HOST_REGISTER(SPL);
+HOST_REGISTER(SPH);
+HOST_REGISTER(GPIOR0);
+HOST_REGISTER(GPIOR1);
+HOST_REGISTER(GPIOR2);
+
+//Bit numbers the firmware uses
+#define PRUSART0	1
+#define U2X0		1
+#define RXEN0		4
+#define TXEN0		3
+#define RXCIE0		7
+#define UCSZ00		1
+#define UCSZ01		2
+#define UDRE0		5
+#define RXC0		7
+#define DOR0		3
+#define FE0			4
+#define COM1A1		7
+#define COM1B1		5
+#define WGM10		0
+#define WGM12		3
+#define CS10		0
+#define CS01		1
+#define CS00		0
+#define ADEN		7
+#define ADPS2		2
+#define ADPS1		1
+#define ADPS0		0
+#define ADSC		6
+#define SPE			6
+#define MSTR		4
+#define SPI2X		0
+#define SPIF		7
+#define INT0		0
+#define INT1		1
+#define PB1			1
+#define PD6			6
+#define PD7			7
+#define OCF0A		1
+#define OCF2A		1
+#define TOV0		0
+
+#define RAMSTART	0x100
+#define RAMEND		0x8FF
+
+#define _SFR_IO_ADDR(sfr)	0
+#define _SFR_MEM_ADDR(sfr)	0
+
+#endif /*HOST_IO_H*/
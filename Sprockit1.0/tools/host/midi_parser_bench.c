@@ -0,0 +1,332 @@
+/*
+@file midi_parser_bench.c
+
+@brief Host throughput benchmark for the MIDI receive parser, handle_incoming_midi_byte() in midi.c.
+
+It feeds byte streams through the parser and reports bytes per second on the host. The numbers only mean
+anything compared with each other, before and after a change to the parser, on the same machine. The built in
+streams are the three kinds of traffic that used to trip the parser up:
+- clock: a dense note and controller stream from a DAW with a timing clock after every byte
+- sysex: notes between 1K SysEx dumps from a librarian, with clocks inside the dumps
+- running status: note, controller and pitch wheel runs that only send their status byte once
+Raw captures of real traffic (for example from amidi --receive) can be given on the command line as well.
+
+The incoming fifo is emptied whenever it is half full, and at the end of every pass, the way the dispatch task
+would, so the parser never runs into a full fifo. The messages that came out are counted, so a change that breaks parsing shows up as a
+different count as well as a different speed.
+
+Build and run it with tools/host_check.py, or by hand from the firmware directory:
+
+	gcc -O2 -fcommon -Itools/host -I. -o midi_parser_bench tools/host/midi_parser_bench.c tools/host/host_registers.c midi.c midi_clock.c
+	./midi_parser_bench [capture.raw ...]
+
+This file is part of Sprockit.
+
+    Sprockit is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Sprockit is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Sprockit.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <pgmspace.h>
+#include <sprockit_main.h>
+#include <midi.h>
+#include <lfo.h>
+#include <audio_block.h>
+
+#define BENCH_STREAM_BYTES		65536		//Length of each built in stream
+#define BENCH_MIN_SECONDS		0.5			//Keep feeding a stream for at least this long
+#define BENCH_SYSEX_DUMP_BYTES	1024		//Data bytes in each SysEx dump of the sysex stream
+
+//midi.c links against these, but the parser never gets to them.
+g_setting global_setting, *p_global_setting = &global_setting;
+const unsigned char AUC_PARAMETER_CONSUMERS[NUMBER_OF_PARAMETERS];
+const unsigned char auc_lfo_dest_decode[LFO_DEST_DECODE_ENTRIES];
+
+unsigned char
+audio_block_render(g_setting *p_global_setting)
+{
+	return 0;
+}
+
+typedef struct
+{
+	const char *p_c_name;
+	unsigned char *p_uc_bytes;
+	size_t length;
+} BENCH_STREAM;
+
+/*
+@brief This function adds a byte to a stream being built, if there is room.
+
+@param It takes the stream and the byte.
+
+@return It doesn't return anything.
+*/
+static void
+bench_put(BENCH_STREAM *p_stream, unsigned char uc_byte)
+{
+	if(p_stream->length < BENCH_STREAM_BYTES)
+	{
+		p_stream->p_uc_bytes[p_stream->length++] = uc_byte;
+	}
+}
+
+/*
+@brief This function builds the clock stream. Notes and controllers with running status, and a timing clock
+after every byte, which is as dense as clocks can get on the wire.
+
+@param It takes the stream to fill.
+
+@return It doesn't return anything.
+*/
+static void
+bench_build_clock_stream(BENCH_STREAM *p_stream)
+{
+	unsigned int un_step = 0;
+
+	while(p_stream->length < BENCH_STREAM_BYTES)
+	{
+		if((un_step & 0x3F) == 0)
+		{
+			bench_put(p_stream, MIDI_NOTE_ON_MASK | MIDI_CHANNEL_NUMBER);
+			bench_put(p_stream, MIDI_TIMING_CLOCK);
+		}
+		bench_put(p_stream, 36 + (un_step % 48));
+		bench_put(p_stream, MIDI_TIMING_CLOCK);
+		bench_put(p_stream, (un_step & 1) ? 0 : 100);
+		bench_put(p_stream, MIDI_TIMING_CLOCK);
+
+		if((un_step & 0x0F) == 0x0F)
+		{
+			bench_put(p_stream, MIDI_CONTROL_CHANGE_MASK | MIDI_CHANNEL_NUMBER);
+			bench_put(p_stream, MIDI_TIMING_CLOCK);
+			bench_put(p_stream, 1);
+			bench_put(p_stream, MIDI_TIMING_CLOCK);
+			bench_put(p_stream, un_step & 0x7F);
+			bench_put(p_stream, MIDI_TIMING_CLOCK);
+			bench_put(p_stream, MIDI_NOTE_ON_MASK | MIDI_CHANNEL_NUMBER);
+		}
+		un_step++;
+	}
+}
+
+/*
+@brief This function builds the SysEx stream. A few notes, then a dump with a clock every 32 bytes inside it.
+
+@param It takes the stream to fill.
+
+@return It doesn't return anything.
+*/
+static void
+bench_build_sysex_stream(BENCH_STREAM *p_stream)
+{
+	unsigned int un_index;
+	unsigned char uc_note = 0;
+
+	while(p_stream->length < BENCH_STREAM_BYTES)
+	{
+		for(un_index = 0; un_index < 4; un_index++, uc_note++)
+		{
+			bench_put(p_stream, MIDI_NOTE_ON_MASK | MIDI_CHANNEL_NUMBER);
+			bench_put(p_stream, 48 + (uc_note % 24));
+			bench_put(p_stream, (uc_note & 1) ? 0 : 90);
+		}
+
+		bench_put(p_stream, MIDI_SYSTEM_EXCLUSIVE);
+		for(un_index = 0; un_index < BENCH_SYSEX_DUMP_BYTES; un_index++)
+		{
+			if((un_index & 0x1F) == 0x1F)
+			{
+				bench_put(p_stream, MIDI_TIMING_CLOCK);
+			}
+			bench_put(p_stream, (un_index * 37) & 0x7F);
+		}
+		bench_put(p_stream, MIDI_END_OF_EXCLUSIVE);
+	}
+}
+
+/*
+@brief This function builds the running status stream. Long runs of notes, controller sweeps and pitch wheel
+moves, each with a single status byte, and now and then a message for another channel to be skipped.
+
+@param It takes the stream to fill.
+
+@return It doesn't return anything.
+*/
+static void
+bench_build_running_status_stream(BENCH_STREAM *p_stream)
+{
+	unsigned int un_run = 0;
+	unsigned int un_index;
+
+	while(p_stream->length < BENCH_STREAM_BYTES)
+	{
+		bench_put(p_stream, MIDI_NOTE_ON_MASK | MIDI_CHANNEL_NUMBER);
+		for(un_index = 0; un_index < 32; un_index++)
+		{
+			bench_put(p_stream, 40 + (un_index % 12));
+			bench_put(p_stream, (un_index & 1) ? 0 : 64 + un_index);
+		}
+
+		bench_put(p_stream, MIDI_CONTROL_CHANGE_MASK | MIDI_CHANNEL_NUMBER);
+		for(un_index = 0; un_index < 32; un_index++)
+		{
+			bench_put(p_stream, 2 + (un_run % 20));
+			bench_put(p_stream, un_index * 4);
+		}
+
+		bench_put(p_stream, MIDI_PITCH_WHEEL_MASK | MIDI_CHANNEL_NUMBER);
+		for(un_index = 0; un_index < 32; un_index++)
+		{
+			bench_put(p_stream, un_index * 4);
+			bench_put(p_stream, 0x40 + (un_index >> 1));
+		}
+
+		bench_put(p_stream, MIDI_NOTE_ON_MASK | ((MIDI_CHANNEL_NUMBER + 1) & 0x0F));
+		for(un_index = 0; un_index < 8; un_index++)
+		{
+			bench_put(p_stream, 60 + un_index);
+			bench_put(p_stream, 100);
+		}
+		un_run++;
+	}
+}
+
+/*
+@brief This function reads a raw capture into a stream.
+
+@param It takes the file name and the stream to fill.
+
+@return It returns 0 if the file was read, 1 if it wasn't.
+*/
+static int
+bench_read_capture(const char *p_c_file, BENCH_STREAM *p_stream)
+{
+	FILE *p_file = fopen(p_c_file, "rb");
+	long length;
+
+	if(p_file == NULL || fseek(p_file, 0, SEEK_END) != 0 || (length = ftell(p_file)) <= 0)
+	{
+		fprintf(stderr, "can't read %s\n", p_c_file);
+		if(p_file != NULL)
+		{
+			fclose(p_file);
+		}
+		return 1;
+	}
+
+	rewind(p_file);
+	p_stream->p_c_name = p_c_file;
+	p_stream->p_uc_bytes = malloc(length);
+	p_stream->length = fread(p_stream->p_uc_bytes, 1, length, p_file);
+	fclose(p_file);
+	return 0;
+}
+
+/*
+@brief This function feeds a stream through the parser over and over for at least BENCH_MIN_SECONDS and prints
+how fast it went.
+
+@param It takes the stream.
+
+@return It doesn't return anything.
+*/
+static void
+bench_run(const BENCH_STREAM *p_stream)
+{
+	MIDI_MESSAGE mm_message;
+	struct timespec st_start, st_end;
+	unsigned long ul_passes = 0;
+	unsigned long ul_messages = 0;
+	double d_seconds;
+	size_t index;
+
+	midi_init();
+	clock_gettime(CLOCK_MONOTONIC, &st_start);
+
+	do
+	{
+		for(index = 0; index < p_stream->length; index++)
+		{
+			handle_incoming_midi_byte(p_stream->p_uc_bytes[index]);
+
+			if(g_uc_midi_messages_in_incoming_fifo >= MIDI_MESSAGE_INCOMING_FIFO_SIZE / 2)
+			{
+				while(g_uc_midi_messages_in_incoming_fifo > 0)
+				{
+					get_midi_message_from_incoming_fifo(&mm_message);
+					ul_messages++;
+				}
+			}
+		}
+
+		//Empty it at the end of every pass, so every pass gives the same messages.
+		while(g_uc_midi_messages_in_incoming_fifo > 0)
+		{
+			get_midi_message_from_incoming_fifo(&mm_message);
+			ul_messages++;
+		}
+		ul_passes++;
+
+		clock_gettime(CLOCK_MONOTONIC, &st_end);
+		d_seconds = (st_end.tv_sec - st_start.tv_sec) + (st_end.tv_nsec - st_start.tv_nsec) * 1e-9;
+	}
+	while(d_seconds < BENCH_MIN_SECONDS);
+
+	printf("%-24s %9lu bytes %8lu messages a pass %12.0f bytes/s %7.2f ns/byte\n",
+		   p_stream->p_c_name, (unsigned long)p_stream->length, ul_messages / ul_passes,
+		   ul_passes * p_stream->length / d_seconds, d_seconds * 1e9 / (ul_passes * p_stream->length));
+}
+
+int
+main(int argc, char **argv)
+{
+	static unsigned char auc_clock[BENCH_STREAM_BYTES];
+	static unsigned char auc_sysex[BENCH_STREAM_BYTES];
+	static unsigned char auc_running_status[BENCH_STREAM_BYTES];
+	BENCH_STREAM ast_streams[3] =
+	{
+		{"clock", auc_clock, 0},
+		{"sysex", auc_sysex, 0},
+		{"running status", auc_running_status, 0},
+	};
+	BENCH_STREAM st_capture;
+	int n_arg;
+	int n_failed = 0;
+
+	bench_build_clock_stream(&ast_streams[0]);
+	bench_build_sysex_stream(&ast_streams[1]);
+	bench_build_running_status_stream(&ast_streams[2]);
+
+	for(n_arg = 0; n_arg < 3; n_arg++)
+	{
+		bench_run(&ast_streams[n_arg]);
+	}
+
+	for(n_arg = 1; n_arg < argc; n_arg++)
+	{
+		if(bench_read_capture(argv[n_arg], &st_capture) == 0)
+		{
+			bench_run(&st_capture);
+			free(st_capture.p_uc_bytes);
+		}
+		else
+		{
+			n_failed = 1;
+		}
+	}
+
+	return n_failed;
+}
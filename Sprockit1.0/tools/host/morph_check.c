@@ -0,0 +1,318 @@
+/*
+@file morph_check.c
+
+@brief Host check that the table driven morph engine plays MORPH_1 to MORPH_9 exactly the way the old hand
+written cases in oscillator() did.
+
+The old cases are kept here as the reference, reading the wavetables through today's accessors so the check
+doesn't depend on how the banks are stored. Each morph is run at a low, middle and high note for 2.2M samples,
+long enough for the slowest one (MORPH_8, a step every 4000 samples) to go around its 256 steps twice, with a
+new note partway through. Both oscillator() and the morph's render plan kernel have to match the reference
+sample for sample.
+
+One difference is on purpose: a new note restarts MORPH_8's step timer as well as its index. The old code left
+the timer running, the reference here restarts it.
+
+Build and run it with tools/host_check.py, or by hand from the firmware directory:
+
+	gcc -O2 -fcommon -DASM_KERNELS=0 -Itools/host -I. -o morph_check tools/host/morph_check.c
+		tools/host/host_registers.c oscillator.c wavetables.c wavetable_banks.c
+	./morph_check
+
+This file is part of Sprockit.
+
+    Sprockit is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Sprockit is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Sprockit.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <pgmspace.h>
+#include <sprockit_main.h>
+#include <wavetables.h>
+#include <oscillator.h>
+
+#define CHECK_SAMPLES		2200000UL
+#define CHECK_NEW_NOTE_AT	700001UL	//Sample the new note comes in on
+#define CHECK_REPORTS		8
+
+g_setting global_setting, *p_global_setting = &global_setting;
+
+//The old per oscillator morph state
+typedef struct
+{
+	unsigned char uc_morph_timer;
+	unsigned char uc_morph_index;
+	unsigned char uc_morph_state;
+	unsigned char uc_phase_shifter;
+	unsigned char uc_phase_shift_timer;
+	unsigned int un_morph_index;
+	unsigned int un_morph_timer;
+} REFERENCE_STATE;
+
+/*
+@brief The old oscillator_sync(), plus restarting MORPH_8's timer.
+
+@param It takes the reference state and the waveshape.
+
+@return It doesn't return anything.
+*/
+static void
+reference_sync(REFERENCE_STATE *p_state, unsigned char uc_waveshape)
+{
+	p_state->uc_morph_state = 0;
+	p_state->un_morph_index = 0;
+	p_state->uc_morph_timer = 0;
+	p_state->un_morph_timer = 0;
+
+	if(uc_waveshape != MORPH_7)
+	{
+		p_state->uc_morph_index = 0;
+	}
+}
+
+/*
+@brief Centres a - b on 128 and clips it, the way calculate_square() does.
+
+@param It takes the difference.
+
+@return It returns the sample.
+*/
+static unsigned char
+reference_clip(signed int sn_difference)
+{
+	if(sn_difference > 127)
+	{
+		return 255;
+	}
+	else if(sn_difference < -128)
+	{
+		return 0;
+	}
+	return 128 + sn_difference;
+}
+
+/*
+@brief The envelope pair MORPH_5 and MORPH_6 share. Sample 1 rises in on the simple ramp, sample 2 is the square
+falling away on the sin, and the two are averaged.
+
+@param It takes the reference state, sample 1 before its envelope, the sample index and the table row.
+
+@return It returns the sample.
+*/
+static unsigned char
+reference_envelopes(REFERENCE_STATE *p_state, unsigned char uc_sample, unsigned char uc_sample_index, unsigned char uc_row)
+{
+	unsigned int un_sample_1 = 0;
+	unsigned int un_sample_2 = 0;
+
+	if(p_state->un_morph_index < 255)
+	{
+		un_sample_1 = (uc_sample * wavetable_ramp_simple(p_state->un_morph_index)) >> 8;
+	}
+
+	if(p_state->un_morph_index > 128 && p_state->un_morph_index < 383)
+	{
+		un_sample_2 = calculate_square(uc_sample_index, uc_row, p_state->uc_morph_index);
+		un_sample_2 = (un_sample_2 * (255 - wavetable_sin(p_state->un_morph_index - 128))) >> 8;
+	}
+
+	if(p_state->un_morph_index == 383)
+	{
+		p_state->un_morph_index = 0;
+	}
+
+	return (un_sample_1 + un_sample_2) >> 1;
+}
+
+/*
+@brief The old MORPH_1 to MORPH_9 cases of oscillator().
+
+@param It takes the reference state, the waveshape, the 16 bit phase and the MIDI note.
+
+@return It returns the sample.
+*/
+static unsigned char
+reference_morph(REFERENCE_STATE *p_state, unsigned char uc_waveshape, unsigned int un_phase, unsigned char uc_note)
+{
+	unsigned char uc_row = uc_note >> 2;//Only 32 tables
+	unsigned char uc_sample_index = un_phase >> 8;
+	unsigned char uc_sample_1;
+	unsigned char uc_sample_2;
+
+	switch(uc_waveshape)
+	{
+		case MORPH_1:
+			if(p_state->uc_morph_timer == 0)
+			{
+				p_state->uc_morph_index++;
+				p_state->uc_morph_timer = 10;
+			}
+			p_state->uc_morph_timer--;
+
+			uc_sample_1 = calculate_square(uc_sample_index, uc_row, p_state->uc_morph_index);
+			uc_sample_2 = wavetable_ramp(uc_row, uc_sample_index + 127);
+			return (uc_sample_1 * p_state->uc_morph_index + uc_sample_2 * (255 - p_state->uc_morph_index)) >> 8;
+
+		case MORPH_2:
+			if(p_state->uc_morph_timer == 0)
+			{
+				p_state->uc_morph_index++;
+				p_state->uc_morph_timer = MORPH_2_TIME_PERIOD;
+			}
+			p_state->uc_morph_timer--;
+
+			p_state->uc_phase_shift_timer--;
+			if(p_state->uc_phase_shift_timer == 0)
+			{
+				p_state->uc_phase_shifter++;
+				p_state->uc_phase_shift_timer = PHASE_SHIFT_TIMER_2;
+			}
+
+			uc_sample_1 = wavetable_triangle(uc_row, uc_sample_index);
+			uc_sample_2 = wavetable_ramp(uc_row, uc_sample_index + p_state->uc_phase_shifter);
+			return (uc_sample_1 * p_state->uc_morph_index + uc_sample_2 * (255 - p_state->uc_morph_index)) >> 8;
+
+		case MORPH_3:
+			if(p_state->uc_morph_timer == 0)
+			{
+				p_state->uc_morph_index++;
+				p_state->uc_morph_timer = 50;
+			}
+			p_state->uc_morph_timer--;
+
+			return reference_clip(wavetable_triangle(uc_row, uc_sample_index)
+								  - wavetable_ramp(uc_row, (unsigned char)(uc_sample_index - p_state->uc_morph_index)));
+
+		case MORPH_4:
+			if(p_state->uc_morph_timer == 0)
+			{
+				if(p_state->uc_morph_state == 0)
+				{
+					if(++p_state->uc_morph_index == 255)
+					{
+						p_state->uc_morph_state = 1;
+					}
+				}
+				else if(--p_state->uc_morph_index == 0)
+				{
+					p_state->uc_morph_state = 0;
+				}
+				p_state->uc_morph_timer = 250;
+			}
+			p_state->uc_morph_timer--;
+
+			return calculate_square(uc_sample_index, uc_row, p_state->uc_morph_index);
+
+		case MORPH_5:
+		case MORPH_6:
+			if(p_state->uc_morph_timer == 0)
+			{
+				p_state->un_morph_index++;
+				p_state->uc_morph_timer = (uc_waveshape == MORPH_5) ? 10 : 50;
+			}
+			p_state->uc_morph_timer--;
+
+			uc_sample_1 = (uc_waveshape == MORPH_5) ? wavetable_sin(uc_sample_index) : wavetable_ramp_simple(uc_sample_index);
+			return reference_envelopes(p_state, uc_sample_1, uc_sample_index, uc_row);
+
+		case MORPH_7:
+			if(p_state->uc_morph_timer == 0)
+			{
+				p_state->uc_morph_index++;
+				p_state->uc_morph_timer = 25;
+			}
+			p_state->uc_morph_timer--;
+
+			return calculate_square(uc_sample_index, uc_row, p_state->uc_morph_index);
+
+		case MORPH_8:
+			if(p_state->un_morph_timer == 0)
+			{
+				p_state->uc_morph_index++;
+				p_state->un_morph_timer = 4000;
+			}
+			p_state->un_morph_timer--;
+
+			return calculate_square(uc_sample_index, uc_row, p_state->uc_morph_index);
+
+		default://MORPH_9
+			if(p_state->uc_morph_timer == 0)
+			{
+				p_state->uc_morph_index++;
+				p_state->uc_morph_timer = 10;
+			}
+			p_state->uc_morph_timer--;
+
+			return calculate_square(uc_sample_index, uc_row, p_state->uc_morph_index);
+	}
+}
+
+int
+main(void)
+{
+	static const unsigned char AUC_NOTES[] = {20, 60, 100};
+	static const unsigned long AUL_INCREMENTS[] = {133952UL, 4186UL * 32, 1200000UL};//Phase per sample, 16.8
+	REFERENCE_STATE st_reference;
+	OSCILLATOR_STATE *p_plan_state = &g_ast_oscillator_state[OSCILLATOR_1];
+	OSCILLATOR_STATE *p_switch_state = &g_ast_oscillator_state[OSCILLATOR_2];
+	OSCILLATOR_PLAN st_plan;
+	unsigned char uc_waveshape;
+	unsigned char uc_expected;
+	unsigned char uc_planned;
+	unsigned char uc_switched;
+	unsigned int un_run;
+	unsigned int un_phase;
+	unsigned long ul_reference;
+	unsigned long ul_sample;
+	unsigned long ul_mismatches = 0;
+
+	for(uc_waveshape = MORPH_1; uc_waveshape <= MORPH_9; uc_waveshape++)
+	{
+		for(un_run = 0; un_run < sizeof(AUC_NOTES); un_run++)
+		{
+			initialize_oscillators();
+			memset(&st_reference, 0, sizeof(st_reference));
+			st_plan.uc_waveshape = OSCILLATOR_PLAN_STALE;
+			oscillator_plan_update(&st_plan, uc_waveshape, AUC_NOTES[un_run], 0);
+			ul_reference = 0;
+
+			for(ul_sample = 0; ul_sample < CHECK_SAMPLES; ul_sample++)
+			{
+				if(ul_sample == CHECK_NEW_NOTE_AT)
+				{
+					reference_sync(&st_reference, uc_waveshape);
+					oscillator_sync(p_plan_state, uc_waveshape);
+					oscillator_sync(p_switch_state, uc_waveshape);
+				}
+
+				un_phase = ul_reference >> 8;
+				uc_expected = reference_morph(&st_reference, uc_waveshape, un_phase, AUC_NOTES[un_run]);
+				uc_planned = st_plan.pf_kernel(&st_plan, p_plan_state, un_phase);
+				uc_switched = oscillator(p_switch_state, uc_waveshape, un_phase, AUC_NOTES[un_run]);
+
+				if((uc_planned != uc_expected || uc_switched != uc_expected) && ul_mismatches++ < CHECK_REPORTS)
+				{
+					printf("MORPH_%u note %u sample %lu: old %u, plan %u, oscillator() %u\n", uc_waveshape - MORPH_1 + 1,
+						   AUC_NOTES[un_run], ul_sample, uc_expected, uc_planned, uc_switched);
+				}
+
+				ul_reference = (ul_reference + AUL_INCREMENTS[un_run]) & SAMPLE_REFERENCE_MASK;
+			}
+		}
+	}
+
+	printf("morphs: %lu mismatches over 9 morphs at %u notes, %lu samples each\n",
+		   ul_mismatches, (unsigned int)sizeof(AUC_NOTES), CHECK_SAMPLES);
+	return ul_mismatches != 0;
+}
@@ -0,0 +1,38 @@
+/*
+@file pgmspace.h
+
+@brief Host stand-in for <avr/pgmspace.h>. On the host, program memory is just memory.
+
+This file is part of Sprockit.
+
+    Sprockit is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Sprockit is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Sprockit.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef HOST_PGMSPACE_H
+#define HOST_PGMSPACE_H
+
+#include <stddef.h>
+
+#define PROGMEM
+#define PGM_P	const char *
+
+//The firmware's tables are declared with the types it reads them back as, so these read whatever size those are here.
+#define pgm_read_byte(address)	(*(const unsigned char *)(address))
+#define pgm_read_word(address)	(*(const unsigned int *)(address))
+#define pgm_read_dword(address)	(*(const unsigned long *)(address))
+
+void *
+memcpy_P(void *p_destination, const void *p_source, size_t size);
+
+#endif /*HOST_PGMSPACE_H*/
@@ -0,0 +1,104 @@
+/*
+@file phase_increment_check.c
+
+@brief Host check of the 16.8 fixed point phase increments in AUL_PHASE_INCREMENT_LUT.
+
+Every entry has to be frequency * 2^24 / SAMPLE_FREQUENCY rounded, for the equal tempered frequency of its MIDI
+note (A4, note 69, at 440Hz). The check prints how far the rounding leaves each note from its true pitch, in
+cents, and fails on any entry that isn't the rounded value.
+
+Then it runs a 24 bit sample reference for ten seconds of samples at each note, wrapping it the way the block
+renderer does, and counts the cycles. Each count has to be the note's frequency times ten, give or take one.
+
+Build and run it with tools/host_check.py, or by hand from the firmware directory:
+
+	gcc -O2 -fcommon -DASM_KERNELS=0 -Itools/host -I. -o phase_increment_check tools/host/phase_increment_check.c
+		tools/host/host_registers.c calculate_pitch.c -lm
+	./phase_increment_check
+
+This file is part of Sprockit.
+
+    Sprockit is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Sprockit is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Sprockit.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#include <stdio.h>
+#include <math.h>
+#include <pgmspace.h>
+#include <sprockit_main.h>
+#include <calculate_pitch.h>
+#include <lfo.h>
+
+#define CHECK_SECONDS	10
+
+//calculate_pitch.c links against these, but the table doesn't need them.
+g_setting global_setting, *p_global_setting = &global_setting;
+const unsigned char auc_lfo_dest_decode[LFO_DEST_DECODE_ENTRIES];
+
+int
+main(void)
+{
+	unsigned char uc_note;
+	unsigned long ul_increment;
+	unsigned long ul_expected;
+	unsigned long ul_reference;
+	unsigned long ul_sample;
+	unsigned long ul_cycles;
+	unsigned long ul_failures = 0;
+	double d_frequency;
+	double d_cents;
+	double d_worst_cents = 0.0;
+	unsigned char uc_worst_note = 0;
+
+	for(uc_note = 0; uc_note < 128; uc_note++)
+	{
+		d_frequency = 440.0 * pow(2.0, (uc_note - 69) / 12.0);
+		ul_increment = pgm_read_dword(&AUL_PHASE_INCREMENT_LUT[uc_note]);
+		ul_expected = (unsigned long)floor(d_frequency * 16777216.0 / SAMPLE_FREQUENCY + 0.5);
+
+		if(ul_increment != ul_expected)
+		{
+			printf("note %u: increment %lu, should be %lu\n", uc_note, ul_increment, ul_expected);
+			ul_failures++;
+		}
+
+		d_cents = 1200.0 * log2(ul_increment * (double)SAMPLE_FREQUENCY / 16777216.0 / d_frequency);
+		if(fabs(d_cents) > fabs(d_worst_cents))
+		{
+			d_worst_cents = d_cents;
+			uc_worst_note = uc_note;
+		}
+
+		//The accumulator, as audio_block_render() runs it
+		ul_reference = 0;
+		ul_cycles = 0;
+		for(ul_sample = 0; ul_sample < (unsigned long)SAMPLE_FREQUENCY * CHECK_SECONDS; ul_sample++)
+		{
+			ul_reference += ul_increment;
+			if(ul_reference & SAMPLE_REFERENCE_WRAP)
+			{
+				ul_reference &= SAMPLE_REFERENCE_MASK;
+				ul_cycles++;
+			}
+		}
+
+		if(fabs(ul_cycles - d_frequency * CHECK_SECONDS) > 1.0)
+		{
+			printf("note %u: %lu cycles in %u seconds, should be %.1f\n", uc_note, ul_cycles, CHECK_SECONDS, d_frequency * CHECK_SECONDS);
+			ul_failures++;
+		}
+	}
+
+	printf("phase increments: %lu failures, furthest from pitch is note %u at %+.3f cents\n", ul_failures, uc_worst_note, d_worst_cents);
+	return ul_failures != 0;
+}
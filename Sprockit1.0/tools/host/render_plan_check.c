@@ -0,0 +1,87 @@
+/*
+@file render_plan_check.c
+
+@brief Host check that every render plan kernel gives the same samples as oscillator(), the per sample
+switch the plans replaced.
+
+For each waveshape with its own plan kernel, for every note and every 16 bit phase, the sample from the plan
+built by oscillator_plan_update() has to match oscillator() bit for bit. It covers the C kernels, so build it
+with ASM_KERNELS at 0. The assembly kernels are held to the C ones on the chip by ASM_KERNEL_CHECK.
+
+The bottom and top two notes of the ramp and triangle waveshapes are left out. oscillator() blends them with a
+row past the end of the bank there, which the plan clamps instead.
+
+Build and run it with tools/host_check.py, or by hand from the firmware directory:
+
+	gcc -O2 -fcommon -DASM_KERNELS=0 -Itools/host -I. -o render_plan_check tools/host/render_plan_check.c
+		tools/host/host_registers.c oscillator.c wavetables.c wavetable_banks.c
+	./render_plan_check
+
+This file is part of Sprockit.
+
+    Sprockit is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Sprockit is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Sprockit.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#include <stdio.h>
+#include <sprockit_main.h>
+#include <oscillator.h>
+
+#define CHECK_FIRST_NOTE	4
+#define CHECK_LAST_NOTE		123
+#define CHECK_REPORTS		8		//Mismatches printed before it stops saying
+
+g_setting global_setting, *p_global_setting = &global_setting;
+
+int
+main(void)
+{
+	static const unsigned char AUC_WAVESHAPES[] = {SIN, SQUARE, RAMP, TRIANGLE, RAW_SQUARE};
+	OSCILLATOR_PLAN st_plan;
+	unsigned char uc_waveshape;
+	unsigned char uc_note;
+	unsigned char uc_expected;
+	unsigned char uc_planned;
+	unsigned long ul_phase;
+	unsigned long ul_mismatches = 0;
+	unsigned int un_index;
+
+	initialize_oscillators();
+
+	for(un_index = 0; un_index < sizeof(AUC_WAVESHAPES); un_index++)
+	{
+		uc_waveshape = AUC_WAVESHAPES[un_index];
+
+		for(uc_note = CHECK_FIRST_NOTE; uc_note <= CHECK_LAST_NOTE; uc_note++)
+		{
+			st_plan.uc_waveshape = OSCILLATOR_PLAN_STALE;
+			oscillator_plan_update(&st_plan, uc_waveshape, uc_note, 0);
+
+			for(ul_phase = 0; ul_phase < 0x10000UL; ul_phase++)
+			{
+				uc_expected = oscillator(&g_ast_oscillator_state[OSCILLATOR_1], uc_waveshape, ul_phase, uc_note);
+				uc_planned = st_plan.pf_kernel(&st_plan, &g_ast_oscillator_state[OSCILLATOR_1], ul_phase);
+
+				if(uc_planned != uc_expected && ul_mismatches++ < CHECK_REPORTS)
+				{
+					printf("waveshape %u note %u phase %lu: oscillator() %u, plan %u\n",
+						   uc_waveshape, uc_note, ul_phase, uc_expected, uc_planned);
+				}
+			}
+		}
+	}
+
+	printf("render plan: %lu mismatches over %u waveshapes, notes %u to %u, every phase\n",
+		   ul_mismatches, (unsigned int)sizeof(AUC_WAVESHAPES), CHECK_FIRST_NOTE, CHECK_LAST_NOTE);
+	return ul_mismatches != 0;
+}
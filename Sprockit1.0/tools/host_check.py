@@ -0,0 +1,100 @@
+#!/usr/bin/env python3
+"""
+@file host_check.py
+
+@brief Builds the host checks and benchmarks in tools/host with the host C compiler and runs them.
+
+Each one links a few firmware modules against the stand-in headers in tools/host (registers are plain
+variables, program memory is plain memory), so the C code can be exercised without an AVR. A check exits
+with 0 when everything matched and prints what didn't otherwise. A benchmark only prints its numbers.
+half_bank_check needs whole cycles to check against, so tools/half_bank_check.py builds and runs that one.
+
+	python3 tools/host_check.py							build and run all of them
+	python3 tools/host_check.py midi_parser_bench -- x.raw	run one, with arguments for it
+	python3 tools/host_check.py --list
+
+This file is part of Sprockit.
+
+    Sprockit is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Sprockit is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Sprockit.  If not, see <http://www.gnu.org/licenses/>
+"""
+
+import argparse
+import os
+import subprocess
+import sys
+import tempfile
+
+FIRMWARE = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+HOST = os.path.join('tools', 'host')
+
+#-fcommon because the headers define their globals, which avr-gcc links as common symbols.
+CFLAGS = ['-std=gnu99', '-O2', '-fcommon', '-w', '-I' + HOST, '-I.']
+
+#The checks hold the C kernels to their references, the assembly ones are checked on the chip by ASM_KERNEL_CHECK.
+DEFINES = ['-DASM_KERNELS=0']
+
+OSCILLATOR = ['oscillator.c', 'wavetables.c', 'wavetable_banks.c']
+
+#name: (firmware modules it links, what it tells you)
+HARNESSES = {
+	'midi_parser_bench': (['midi.c', 'midi_clock.c'], 'MIDI receive parser throughput on clock, SysEx and running status streams'),
+	'render_plan_check': (OSCILLATOR, 'every render plan kernel against oscillator(), every note and phase'),
+	'morph_check': (OSCILLATOR, 'the table driven morphs against the old MORPH_1 to MORPH_9 cases'),
+	'phase_increment_check': (['calculate_pitch.c'], 'the 16.8 phase increment table against the equal tempered pitches'),
+}
+
+
+def build(cc, name, modules, directory):
+	program = os.path.join(directory, name)
+	sources = [os.path.join(HOST, name + '.c'), os.path.join(HOST, 'host_registers.c')] + modules
+	result = subprocess.run([cc] + CFLAGS + DEFINES + ['-o', program] + sources + ['-lm'], cwd=FIRMWARE, capture_output=True, text=True)
+	if result.returncode != 0:
+		print(result.stderr, end='')
+		return None
+	return program
+
+def main():
+	parser = argparse.ArgumentParser(description='Build and run the Sprockit host checks.')
+	parser.add_argument('names', nargs='*', help='which ones to run, all of them if none are given')
+	parser.add_argument('--list', action='store_true', help='list them and stop')
+	parser.add_argument('--cc', default='cc', help='the host C compiler')
+	argv = sys.argv[1:]
+	extra = argv[argv.index('--') + 1:] if '--' in argv else []
+	args = parser.parse_args(argv[:len(argv) - len(extra) - 1] if '--' in argv else argv)
+
+	if args.list:
+		for name in sorted(HARNESSES):
+			print('%-24s %s' % (name, HARNESSES[name][1]))
+		return 0
+
+	names = args.names or sorted(HARNESSES)
+	unknown = [name for name in names if name not in HARNESSES]
+	if unknown:
+		sys.exit('no such check: ' + ' '.join(unknown))
+
+	failed = []
+	with tempfile.TemporaryDirectory() as directory:
+		for name in names:
+			print('== ' + name, flush=True)
+			program = build(args.cc, name, HARNESSES[name][0], directory)
+			if program is None or subprocess.run([program] + extra, cwd=FIRMWARE).returncode != 0:
+				failed.append(name)
+
+	if failed:
+		print('FAILED: ' + ' '.join(failed))
+		return 1
+	return 0
+
+if __name__ == '__main__':
+	sys.exit(main())
@@ -0,0 +1,254 @@
+#!/usr/bin/env python3
+"""
+@file memory_report.py
+
+@brief Says where the ATmega328P's 2K of RAM and 32K of flash went, per module and per symbol, estimates the
+deepest the stack can get, and fails if any of that is over the budgets in tools/memory_budget.ini.
+
+It reads the object files and the linked ELF with avr-objdump, and the stack frames from the .su files that
+-fstack-usage writes next to each object. Build with it as the last step:
+
+	avr-gcc -mmcu=atmega328p -Os -fstack-usage -c *.c
+	avr-gcc -mmcu=atmega328p -o Sprockit.elf *.o
+	python3 tools/memory_report.py Sprockit.elf *.o
+
+The estimate can't see which call chains really overlap with which interrupts. The firmware measures the real
+peak itself (stack_monitor.c). Read g_un_stack_monitor_peak off the running synth with a debugger or the
+simulator after a good workout, and pass it in with --measured to have it checked against the budget too.
+
+This file is part of Sprockit.
+
+    Sprockit is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Sprockit is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Sprockit.  If not, see <http://www.gnu.org/licenses/>
+"""
+
+import argparse
+import configparser
+import fnmatch
+import os
+import re
+import subprocess
+import sys
+
+RETURN_ADDRESS = 2		#Bytes a call pushes on the 328P
+INTERRUPT_ENTRY = 2		#The return address an interrupt pushes; the vector's own pushes are in its .su frame,
+						#or in [vector_stack] in memory_budget.ini for a naked one
+
+#objdump -t: value (the size for *COM*), flags, section, size (the alignment for *COM*), name
+SYMBOL = re.compile(r'^([0-9a-fA-F]+)\s(.{7})\s(\S+)\s+([0-9a-fA-F]+)\s+(\S+)$')
+#objdump -h: index, name, size
+SECTION = re.compile(r'^\s*\d+\s+(\S+)\s+([0-9a-fA-F]+)\s')
+#objdump -d: a function label, and a call or jump to one
+LABEL = re.compile(r'^[0-9a-fA-F]+ <([A-Za-z_][\w.]*)>:$')
+CALL = re.compile(r'\s(call|rcall|jmp|rjmp)\s.*<([A-Za-z_][\w.]*)>\s*$')
+INDIRECT = re.compile(r'\s(icall|eicall|ijmp|eijmp)\b')
+#.su: file:line:column:function  bytes  static|dynamic|bounded
+STACK_USAGE = re.compile(r'^\S*?:\d+:\d+:(\S+)\s+(\d+)\s+(\S+)')
+
+
+def objdump(tool, *args):
+	try:
+		return subprocess.run([tool] + list(args), check=True, capture_output=True, text=True).stdout
+	except (OSError, subprocess.CalledProcessError) as error:
+		sys.exit('%s %s failed: %s' % (tool, ' '.join(args), error))
+
+def kind_of(section):
+	"""Which memory a section ends up in. avr-gcc puts const data that isn't PROGMEM in .rodata, which the
+	linker copies into RAM with .data."""
+	if section.startswith('.progmem'):
+		return 'progmem'
+	if section.startswith('.bss') or section == '*COM*' or section.startswith('.noinit'):
+		return 'bss'
+	if section.startswith('.data') or section.startswith('.rodata'):
+		return 'data'
+	if section.startswith('.text'):
+		return 'text'
+	return None
+
+def module_symbols(tool, objects):
+	"""Every object's data symbols as {name: (module, kind, size)}. A header's tentative declarations come out as
+	common symbols in every file that includes it, so they only count where nothing defines them for real."""
+	symbols = {}
+	common = {}
+	for path in objects:
+		module = os.path.splitext(os.path.basename(path))[0]
+		for line in objdump(tool, '-t', path).splitlines():
+			match = SYMBOL.match(line)
+			if not match or 'O' not in match.group(2):
+				continue
+			section, name = match.group(3), match.group(5)
+			size = int(match.group(1 if section == '*COM*' else 4), 16)
+			kind = kind_of(section)
+			if kind not in ('data', 'bss', 'progmem') or size == 0:
+				continue
+			if section == '*COM*':
+				common.setdefault(name, (module, kind, size))
+			else:
+				symbols[name + ('' if 'g' in match.group(2) else ' (' + module + ')')] = (module, kind, size)
+	for name, entry in common.items():
+		if name not in symbols:
+			symbols[name] = entry
+	return symbols
+
+def section_totals(tool, elf):
+	totals = {'text': 0, 'data': 0, 'bss': 0}
+	for line in objdump(tool, '-h', elf).splitlines():
+		match = SECTION.match(line)
+		if match and match.group(1) in ('.text', '.data', '.bss', '.noinit'):
+			totals['bss' if match.group(1) == '.noinit' else match.group(1)[1:]] += int(match.group(2), 16)
+	return totals
+
+def call_graph(tool, elf):
+	"""{function: (set of direct callees, makes indirect calls)} from the disassembly."""
+	graph = {}
+	current = None
+	for line in objdump(tool, '-d', elf).splitlines():
+		match = LABEL.match(line)
+		if match:
+			current = match.group(1)
+			graph.setdefault(current, [set(), False])
+			continue
+		if current is None:
+			continue
+		match = CALL.search(line)
+		if match and match.group(2) != current:
+			graph[current][0].add(match.group(2))
+		elif INDIRECT.search(line):
+			graph[current][1] = True
+	return graph
+
+def frame_sizes(objects):
+	frames = {}
+	unbounded = set()
+	for path in objects:
+		su = os.path.splitext(path)[0] + '.su'
+		if not os.path.exists(su):
+			continue
+		with open(su) as usage:
+			for line in usage:
+				match = STACK_USAGE.match(line)
+				if match:
+					frames[match.group(1)] = max(frames.get(match.group(1), 0), int(match.group(2)))
+					if match.group(3) == 'dynamic':
+						unbounded.add(match.group(1))
+	return frames, unbounded
+
+def deepest(function, graph, frames, indirect, seen, notes, memo):
+	"""The most stack a call to function can take, return address included, and the chain that takes it."""
+	if function in memo:
+		return memo[function]
+	if function in seen:
+		notes.add('recursion through ' + function + ', counted once')
+		return 0, []
+	callees, makes_indirect = graph.get(function, (set(), False))
+	targets = set(callees)
+	if makes_indirect:
+		patterns = indirect.get(function)
+		if patterns is None:
+			notes.add(function + ' calls through a pointer that memory_budget.ini doesn\'t list')
+		else:
+			targets |= {name for name in graph for pattern in patterns if fnmatch.fnmatch(name, pattern)}
+	best, chain = 0, []
+	for callee in targets:
+		depth, callee_chain = deepest(callee, graph, frames, indirect, seen | {function}, notes, memo)
+		if depth > best:
+			best, chain = depth, callee_chain
+	memo[function] = (frames.get(function, 0) + RETURN_ADDRESS + best, [function] + chain)
+	return memo[function]
+
+def stack_estimate(graph, frames, indirect, vector_extra, notes):
+	memo = {}
+	main_depth, main_chain = deepest('main', graph, frames, indirect, frozenset(), notes, memo)
+	vector_depth, vector_chain = 0, []
+	for name in graph:
+		if name.startswith('__vector_') and name != '__vector_default':
+			depth, chain = deepest(name, graph, frames, indirect, frozenset(), notes, memo)
+			depth += vector_extra.get(name, 0)
+			if depth > vector_depth:
+				vector_depth, vector_chain = depth, chain
+	#Interrupts don't nest here, so the worst case is main's deepest chain with the deepest vector on top
+	return main_depth + vector_depth + (INTERRUPT_ENTRY - RETURN_ADDRESS if vector_chain else 0), main_chain, vector_chain
+
+def main():
+	parser = argparse.ArgumentParser(description='RAM, flash and stack report for the Sprockit firmware.')
+	parser.add_argument('elf', help='the linked firmware')
+	parser.add_argument('objects', nargs='+', help='the object files it was linked from, with their .su files beside them')
+	parser.add_argument('--budget', default=os.path.join(os.path.dirname(os.path.abspath(__file__)), 'memory_budget.ini'))
+	parser.add_argument('--objdump', default='avr-objdump')
+	parser.add_argument('--symbols', type=int, default=20, help='how many of the biggest symbols to list per memory')
+	parser.add_argument('--measured', type=int, help='the stack peak the firmware measured, g_un_stack_monitor_peak')
+	args = parser.parse_args()
+
+	config = configparser.ConfigParser()
+	if not config.read(args.budget):
+		sys.exit('can\'t read ' + args.budget)
+	budget = {key: int(value) for key, value in config['budget'].items()}
+	indirect = {key: value.split() for key, value in config['stack'].items()} if config.has_section('stack') else {}
+	vector_extra = {key: int(value) for key, value in config['vector_stack'].items()} if config.has_section('vector_stack') else {}
+
+	symbols = module_symbols(args.objdump, args.objects)
+	totals = section_totals(args.objdump, args.elf)
+	frames, unbounded = frame_sizes(args.objects)
+	notes = set('%s has a dynamic frame, only its fixed part is counted' % name for name in unbounded)
+	stack, main_chain, vector_chain = stack_estimate(call_graph(args.objdump, args.elf), frames, indirect, vector_extra, notes)
+	progmem = sum(size for module, kind, size in symbols.values() if kind == 'progmem')
+
+	modules = {}
+	for module, kind, size in symbols.values():
+		modules.setdefault(module, {'data': 0, 'bss': 0, 'progmem': 0})[kind] += size
+
+	print('%-24s %8s %8s %8s' % ('Module', '.data', '.bss', 'progmem'))
+	for module in sorted(modules, key=lambda m: -(modules[m]['data'] + modules[m]['bss'])):
+		usage = modules[module]
+		print('%-24s %8d %8d %8d' % (module, usage['data'], usage['bss'], usage['progmem']))
+
+	for kind in ('data', 'bss', 'progmem'):
+		biggest = sorted(((size, name, module) for name, (module, k, size) in symbols.items() if k == kind), reverse=True)
+		if biggest:
+			print('\nBiggest .%s symbols' % kind if kind != 'progmem' else '\nBiggest progmem symbols')
+			for size, name, module in biggest[:args.symbols]:
+				print('  %6d  %-40s %s' % (size, name, module))
+
+	static_ram = totals['data'] + totals['bss']
+	flash = totals['text'] + totals['data']
+	print('\nStack estimate %d bytes' % stack)
+	print('  main:      ' + ' > '.join(main_chain))
+	if vector_chain:
+		print('  interrupt: ' + ' > '.join(vector_chain))
+	for note in sorted(notes):
+		print('  note: ' + note)
+	if args.measured is not None:
+		if args.measured > stack:
+			print('Stack measured %d bytes, over the estimate. Something deeper than it can see ran.' % args.measured)
+		else:
+			print('Stack measured %d bytes, %d under the estimate' % (args.measured, stack - args.measured))
+
+	checks = [
+		('static RAM (.data + .bss)', static_ram, budget['static_ram']),
+		('stack', stack, budget['stack']),
+		('RAM', static_ram + stack, budget['ram']),
+		('flash (.text + .data)', flash, budget['flash']),
+		('progmem', progmem, budget['progmem']),
+	]
+	if args.measured is not None:
+		checks[2:2] = [('measured stack', args.measured, budget['stack']),
+			('RAM, measured stack', static_ram + args.measured, budget['ram'])]
+	print()
+	over = False
+	for name, used, limit in checks:
+		print('%-28s %6d of %6d%s' % (name, used, limit, '  OVER BUDGET' if used > limit else ''))
+		over = over or used > limit
+	return 1 if over else 0
+
+if __name__ == '__main__':
+	sys.exit(main())
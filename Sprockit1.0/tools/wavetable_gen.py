@@ -0,0 +1,236 @@
+#!/usr/bin/env python3
+"""
+@file wavetable_gen.py
+
+@brief Builds Sprockit's band limited wavetable banks by additive synthesis and writes them out as
+wavetable_banks.c and wavetable_banks.h, next to sprockit_main.h. Run it on the host whenever a bank, the
+sample rate or the row layout changes, and commit what it writes. Nothing in those two files is edited by hand.
+
+Every row of a note bank holds the harmonics that stay under half of SAMPLE_FREQUENCY at the highest note that
+plays the row, so the rows are only as bright as the sample rate allows. SAMPLE_FREQUENCY is read out of
+sprockit_main.h unless --sample-rate says otherwise.
+
+	python3 tools/wavetable_gen.py						the banks the firmware uses
+	python3 tools/wavetable_gen.py --extra pulse		and the optional pulse bank as well
+	python3 tools/wavetable_gen.py --list				what banks there are
+
+This file is part of Sprockit.
+
+    Sprockit is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Sprockit is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Sprockit.  If not, see <http://www.gnu.org/licenses/>
+"""
+
+import argparse
+import math
+import os
+import re
+import sys
+
+SAMPLES = 256			#Samples in a cycle, the phase's top byte
+HALF_SIZE = SAMPLES // 2 + 1	#A half cycle plus the last sample, see wavetable_half()
+ROWS = 32				#Band limited rows in a note bank
+NOTES_PER_ROW = 4		#MIDI notes that share a row, the oscillator picks the row with note >> 2
+SCAN_FRAMES = 16		#Frames in the scanning bank
+
+SOURCE_DIR = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..'))
+
+LICENSE = """\
+    Sprockit is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Sprockit is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Sprockit.  If not, see <http://www.gnu.org/licenses/>"""
+
+
+#The spectra. Each takes the harmonic number and gives its (sine, cosine) amplitudes.
+def ramp(k):
+	return (1.0 / k, 0.0)
+
+def triangle(k):
+	if k % 2 == 0:
+		return (0.0, 0.0)
+	return ((1.0 if k % 4 == 1 else -1.0) / (k * k), 0.0)
+
+def pulse(k, duty=0.25):
+	#High for the first quarter of the cycle, the DC left out
+	return (math.sin(2 * math.pi * k * duty) / k, (1.0 - math.cos(2 * math.pi * k * duty)) / k)
+
+def formant(k, centre=6.0, width=1.5):
+	#A ramp through a resonant peak, a vowel like buzz that stays put as the note moves
+	return (1.0 / k * (0.15 + 1.0 / (1.0 + ((k - centre) / width) ** 2)), 0.0)
+
+#The scanning frames, as sine amplitudes by harmonic: a sine, a ramp built up from 2 to 16 harmonics,
+#the ramp's even harmonics faded out to a square, then pulses narrowing from 35% to 6%.
+def scan_frames():
+	frames = [{1: 1.0}]
+	for h in (2, 3, 4, 6, 8, 11, 16):
+		frames.append({n: 1.0 / n for n in range(1, h + 1)})
+	for t in (0.25, 0.5, 0.75, 1.0):
+		frames.append({n: (1.0 / n if n % 2 else (1 - t) / n) for n in range(1, 17)})
+	for d in (0.35, 0.22, 0.12, 0.06):
+		frames.append({n: math.sin(math.pi * n * d) / n for n in range(1, 17)})
+	return frames[:SCAN_FRAMES]
+
+#name: (C array, spectrum, highest harmonic, stored as half cycles, used by the firmware, comment)
+NOTE_BANKS = {
+	'triangle':	('G_AUC_TRIANGLE_WAVETABLE_LUT', triangle, 9, True, True,
+				 'Half cycles of the band limited triangles, odd harmonics up to the 9th. Read them with wavetable_half().'),
+	'ramp':		('G_AUC_RAMP_WAVETABLE_LUT', ramp, SAMPLES // 2 - 1, True, True,
+				 'Half cycles of the band limited ramps, every harmonic. Read them with wavetable_half().'),
+	'pulse':	('G_AUC_PULSE_WAVETABLE_LUT', pulse, SAMPLES // 2 - 1, False, False,
+				 'Whole cycles of a band limited 25% pulse.'),
+	'formant':	('G_AUC_FORMANT_WAVETABLE_LUT', formant, SAMPLES // 2 - 1, False, False,
+				 'Whole cycles of a ramp through a resonant peak at the 6th harmonic.'),
+}
+
+
+def note_frequency(note):
+	return 440.0 * 2.0 ** ((note - 69) / 12.0)
+
+def harmonic_limit(row, sample_rate, notes_per_row, highest):
+	"""The most harmonics the highest note of the row can have without folding back past half the sample rate."""
+	top_note = min((row + 1) * notes_per_row - 1, 127)
+	return max(1, min(highest, int((sample_rate / 2.0) / note_frequency(top_note))))
+
+def synthesize(coefficients, offset):
+	"""One cycle of sum(sin_k sin(2 pi k x) + cos_k cos(2 pi k x)), sample i at x = (i + offset) / SAMPLES."""
+	cycle = []
+	for i in range(SAMPLES):
+		x = 2 * math.pi * (i + offset) / SAMPLES
+		cycle.append(sum(s * math.sin(k * x) + c * math.cos(k * x) for k, (s, c) in coefficients.items()))
+	return cycle
+
+def quantize_symmetric(cycle):
+	"""0 to 255, full scale. The cycle is odd about sample 127, so only the first half is rounded and the
+	second half is that turned over, which keeps sample 254 - n exactly 255 - sample n for wavetable_half()."""
+	peak = max(abs(v) for v in cycle)
+	first = [min(255, max(0, int(math.floor(128 + round(127.5 * v / peak, 9))))) for v in cycle[:SAMPLES // 2]]
+	last = min(255, max(0, int(math.floor(128 + round(127.5 * cycle[-1] / peak, 9)))))
+	return first + [255 - v for v in reversed(first[:-1])] + [last]
+
+def quantize(cycle):
+	"""128 +/- 127, full scale."""
+	peak = max(abs(v) for v in cycle)
+	return [max(0, min(255, int(round(128 + 127 * v / peak)))) for v in cycle]
+
+def half_row(cycle):
+	"""The layout wavetable_half() reads: sample 255 turned over, then samples 0 to 127."""
+	for n in range(SAMPLES // 2 - 1):
+		assert cycle[SAMPLES - 2 - n] == 255 - cycle[n], 'not odd symmetric about sample 127'
+	return [255 - cycle[-1]] + cycle[:SAMPLES // 2]
+
+def note_cycles(spectrum, highest, half, sample_rate, notes_per_row):
+	"""The bank's rows as whole cycles, before the half ones are folded. tools/half_bank_check.py checks against these."""
+	cycles = []
+	for row in range(ROWS):
+		limit = harmonic_limit(row, sample_rate, notes_per_row, highest)
+		coefficients = {k: spectrum(k) for k in range(1, limit + 1)}
+		if half:
+			#Sampled a sample early, as the tables always have been, so the cycle mirrors about sample 127
+			cycles.append(quantize_symmetric(synthesize(coefficients, 1)))
+		else:
+			cycles.append(quantize(synthesize(coefficients, 0)))
+	return cycles
+
+def note_bank(spectrum, highest, half, sample_rate, notes_per_row):
+	cycles = note_cycles(spectrum, highest, half, sample_rate, notes_per_row)
+	return [half_row(cycle) for cycle in cycles] if half else cycles
+
+def scan_bank():
+	return [quantize(synthesize({k: (a, 0.0) for k, a in frame.items()}, 0)) for frame in scan_frames()]
+
+
+def read_sample_rate():
+	with open(os.path.join(SOURCE_DIR, 'sprockit_main.h')) as header:
+		match = re.search(r'^#define\s+SAMPLE_FREQUENCY\s+(\d+)', header.read(), re.M)
+	if not match:
+		sys.exit('SAMPLE_FREQUENCY not found in sprockit_main.h, give it with --sample-rate')
+	return int(match.group(1))
+
+def c_array(name, dimensions, rows, comment):
+	lines = ['//' + comment, 'const unsigned char %s %s PROGMEM = { ' % (name, dimensions)]
+	lines += ['{' + ','.join(str(v) for v in row) + ',},' for row in rows]
+	lines.append('};')
+	return '\n'.join(lines)
+
+def write(path, text):
+	with open(path, 'w', newline='\r\n') as out:
+		out.write(text)
+
+def main():
+	parser = argparse.ArgumentParser(description='Generate the band limited wavetable banks.')
+	parser.add_argument('--sample-rate', type=int, help='Hz, SAMPLE_FREQUENCY from sprockit_main.h by default')
+	parser.add_argument('--notes-per-row', type=int, default=NOTES_PER_ROW, help='MIDI notes that share a row')
+	parser.add_argument('--extra', action='append', default=[], choices=[n for n, b in NOTE_BANKS.items() if not b[4]],
+						help='an optional bank to emit as well, may be given more than once')
+	parser.add_argument('--output-dir', default=SOURCE_DIR, help='where to write wavetable_banks.c and .h')
+	parser.add_argument('--list', action='store_true', help='list the banks and stop')
+	args = parser.parse_args()
+
+	if args.list:
+		for name, bank in NOTE_BANKS.items():
+			print('%-10s %s%s' % (name, bank[0], '' if bank[4] else ' (--extra)'))
+		print('%-10s %s' % ('scan', 'G_AUC_SCAN_WAVETABLE_LUT'))
+		return
+
+	sample_rate = args.sample_rate or read_sample_rate()
+	notes_per_row = args.notes_per_row
+	if ROWS * notes_per_row < 128:
+		sys.exit('%d rows of %d notes don\'t cover the 128 MIDI notes' % (ROWS, notes_per_row))
+
+	generated = ('Generated by tools/wavetable_gen.py, SAMPLE_FREQUENCY %d, %d notes a row. Don\'t edit it, change the\n'
+				 'script and run it again.' % (sample_rate, notes_per_row))
+
+	arrays = []
+	declarations = []
+	extra_bytes = 0
+	for name, (array, spectrum, highest, half, used, comment) in NOTE_BANKS.items():
+		if not used and name not in args.extra:
+			continue
+		size = 'WAVETABLE_HALF_SIZE' if half else str(SAMPLES)
+		dimensions = '[WAVETABLE_BANK_ROWS] [%s]' % size
+		arrays.append(c_array(array, dimensions, note_bank(spectrum, highest, half, sample_rate, notes_per_row), comment))
+		declarations.append('const unsigned char %s %s;' % (array, dimensions))
+		if not used:
+			extra_bytes += ROWS * (HALF_SIZE if half else SAMPLES)
+
+	arrays.append(c_array('G_AUC_SCAN_WAVETABLE_LUT', '[WAVETABLE_SCAN_FRAMES] [%d]' % SAMPLES, scan_bank(),
+						  'The scanning bank for WAVETABLE_SCAN, 16 single cycles of 16 harmonics or fewer. With 16\n'
+						  '//harmonics the frames are clean up to about C6 (MIDI note 84).'))
+	declarations.append('const unsigned char G_AUC_SCAN_WAVETABLE_LUT [WAVETABLE_SCAN_FRAMES] [%d];' % SAMPLES)
+
+	write(os.path.join(args.output_dir, 'wavetable_banks.c'),
+		  '/*\n@file wavetable_banks.c\n\n@brief The band limited wavetable banks, in program memory.\n' + generated +
+		  '\n\nThis file is part of Sprockit.\n\n' + LICENSE + '\n*/\n\n#include <pgmspace.h>\n#include <wavetables.h>\n\n' +
+		  '\n\n'.join(arrays) + '\n')
+
+	write(os.path.join(args.output_dir, 'wavetable_banks.h'),
+		  '/*\n' + generated + '\n\n\tThis file is part of Sprockit.\n\n' + LICENSE + '\n*/\n\n'
+		  '#ifndef WAVETABLE_BANKS_H\n#define WAVETABLE_BANKS_H\n\n'
+		  '#define WAVETABLE_BANK_ROWS\t\t%d\t//Band limited rows in each note bank\n'
+		  '#define WAVETABLE_NOTES_PER_ROW\t%d\t//MIDI notes that share a row\n'
+		  '#define WAVETABLE_HALF_SIZE\t\t%d\t//Half a cycle plus the last sample, which the mirror can\'t give back\n'
+		  '#define WAVETABLE_SCAN_FRAMES\t%d\t//Single cycle frames in the scanning bank\n'
+		  '#define WAVETABLE_EXTRA_BYTES\t%d\t//Flash taken by the --extra banks, which nothing plays yet\n\n'
+		  % (ROWS, notes_per_row, HALF_SIZE, SCAN_FRAMES, extra_bytes) +
+		  '\n'.join(declarations) + '\n\n#endif /*WAVETABLE_BANKS_H*/\n')
+
+if __name__ == '__main__':
+	main()
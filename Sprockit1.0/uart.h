@@ -1,38 +1,50 @@
-/*
-	This file is part of Sprockit.
-
-    Sprockit is free software: you can redistribute it and/or modify
-    it under the terms of the GNU General Public License as published by
-    the Free Software Foundation, either version 3 of the License, or
-    (at your option) any later version.
-
-    Sprockit is distributed in the hope that it will be useful,
-    but WITHOUT ANY WARRANTY; without even the implied warranty of
-    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
-    GNU General Public License for more details.
-
-    You should have received a copy of the GNU General Public License
-    along with Sprockit.  If not, see <http://www.gnu.org/licenses/>
-*/
-
-#ifndef UART_H
-#define UART_H
-
-void 
-uart_init(void);
-
-unsigned char
-uart_get_byte(void);
-
-void
-uart_transmit_byte(unsigned char uc_byte);
-
-unsigned char 
-uart_tx_buffer_empty(void);
-
-unsigned char
-uart_rx_buffer_has_byte(void);
-
-
-
-#endif //UART_H
+/*
+	This file is part of Sprockit.
+
+    Sprockit is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Sprockit is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Sprockit.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef UART_H
+#define UART_H
+
+//The receive ring buffer size has to be a power of two so the indices can wrap with a mask.
+//At 31250 baud a byte shows up every 320us, so 32 bytes covers about 10ms of the main loop being busy.
+#define UART_RX_BUFFER_SIZE		32
+#define UART_RX_BUFFER_MASK		(UART_RX_BUFFER_SIZE - 1)
+
+extern volatile unsigned char g_auc_uart_rx_buffer[UART_RX_BUFFER_SIZE];
+extern volatile unsigned char g_uc_uart_rx_head;
+extern volatile unsigned char g_uc_uart_rx_tail;
+extern volatile unsigned char g_uc_uart_rx_overrun_count;
+extern volatile unsigned char g_uc_uart_rx_hardware_overrun_count;
+extern volatile unsigned char g_uc_uart_rx_high_water_mark;
+
+void 
+uart_init(void);
+
+unsigned char
+uart_get_byte(void);
+
+void
+uart_transmit_byte(unsigned char uc_byte);
+
+unsigned char 
+uart_tx_buffer_empty(void);
+
+unsigned char
+uart_rx_buffer_has_byte(void);
+
+
+
+#endif //UART_H
@@ -0,0 +1,118 @@
+/*
+@file wavetable_banks.c
+
+@brief The band limited wavetable banks, in program memory.
+Generated by tools/wavetable_gen.py, SAMPLE_FREQUENCY 32768, 4 notes a row. Don't edit it, change the
+script and run it again.
+
+This file is part of Sprockit.
+
+    Sprockit is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Sprockit is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Sprockit.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#include <pgmspace.h>
+#include <wavetables.h>
+
+//Half cycles of the band limited triangles, odd harmonics up to the 9th. Read them with wavetable_half().
+const unsigned char G_AUC_TRIANGLE_WAVETABLE_LUT [WAVETABLE_BANK_ROWS] [WAVETABLE_HALF_SIZE] PROGMEM = { 
+{127,130,132,134,136,138,140,143,145,147,149,151,152,154,156,158,160,162,164,166,168,171,173,175,177,179,182,184,186,188,190,193,195,197,199,201,203,204,206,208,210,212,214,216,218,220,222,224,227,229,231,234,236,239,241,243,246,248,249,251,252,254,254,255,255,255,254,254,252,251,249,248,246,243,241,239,236,234,231,229,227,224,222,220,218,216,214,212,210,208,206,204,203,201,199,197,195,193,190,188,186,184,182,179,177,175,173,171,168,166,164,162,160,158,156,154,152,151,149,147,145,143,140,138,136,134,132,130,128,},
+{127,130,132,134,136,138,140,143,145,147,149,151,152,154,156,158,160,162,164,166,168,171,173,175,177,179,182,184,186,188,190,193,195,197,199,201,203,204,206,208,210,212,214,216,218,220,222,224,227,229,231,234,236,239,241,243,246,248,249,251,252,254,254,255,255,255,254,254,252,251,249,248,246,243,241,239,236,234,231,229,227,224,222,220,218,216,214,212,210,208,206,204,203,201,199,197,195,193,190,188,186,184,182,179,177,175,173,171,168,166,164,162,160,158,156,154,152,151,149,147,145,143,140,138,136,134,132,130,128,},
+{127,130,132,134,136,138,140,143,145,147,149,151,152,154,156,158,160,162,164,166,168,171,173,175,177,179,182,184,186,188,190,193,195,197,199,201,203,204,206,208,210,212,214,216,218,220,222,224,227,229,231,234,236,239,241,243,246,248,249,251,252,254,254,255,255,255,254,254,252,251,249,248,246,243,241,239,236,234,231,229,227,224,222,220,218,216,214,212,210,208,206,204,203,201,199,197,195,193,190,188,186,184,182,179,177,175,173,171,168,166,164,162,160,158,156,154,152,151,149,147,145,143,140,138,136,134,132,130,128,},
+{127,130,132,134,136,138,140,143,145,147,149,151,152,154,156,158,160,162,164,166,168,171,173,175,177,179,182,184,186,188,190,193,195,197,199,201,203,204,206,208,210,212,214,216,218,220,222,224,227,229,231,234,236,239,241,243,246,248,249,251,252,254,254,255,255,255,254,254,252,251,249,248,246,243,241,239,236,234,231,229,227,224,222,220,218,216,214,212,210,208,206,204,203,201,199,197,195,193,190,188,186,184,182,179,177,175,173,171,168,166,164,162,160,158,156,154,152,151,149,147,145,143,140,138,136,134,132,130,128,},
+{127,130,132,134,136,138,140,143,145,147,149,151,152,154,156,158,160,162,164,166,168,171,173,175,177,179,182,184,186,188,190,193,195,197,199,201,203,204,206,208,210,212,214,216,218,220,222,224,227,229,231,234,236,239,241,243,246,248,249,251,252,254,254,255,255,255,254,254,252,251,249,248,246,243,241,239,236,234,231,229,227,224,222,220,218,216,214,212,210,208,206,204,203,201,199,197,195,193,190,188,186,184,182,179,177,175,173,171,168,166,164,162,160,158,156,154,152,151,149,147,145,143,140,138,136,134,132,130,128,},
+{127,130,132,134,136,138,140,143,145,147,149,151,152,154,156,158,160,162,164,166,168,171,173,175,177,179,182,184,186,188,190,193,195,197,199,201,203,204,206,208,210,212,214,216,218,220,222,224,227,229,231,234,236,239,241,243,246,248,249,251,252,254,254,255,255,255,254,254,252,251,249,248,246,243,241,239,236,234,231,229,227,224,222,220,218,216,214,212,210,208,206,204,203,201,199,197,195,193,190,188,186,184,182,179,177,175,173,171,168,166,164,162,160,158,156,154,152,151,149,147,145,143,140,138,136,134,132,130,128,},
+{127,130,132,134,136,138,140,143,145,147,149,151,152,154,156,158,160,162,164,166,168,171,173,175,177,179,182,184,186,188,190,193,195,197,199,201,203,204,206,208,210,212,214,216,218,220,222,224,227,229,231,234,236,239,241,243,246,248,249,251,252,254,254,255,255,255,254,254,252,251,249,248,246,243,241,239,236,234,231,229,227,224,222,220,218,216,214,212,210,208,206,204,203,201,199,197,195,193,190,188,186,184,182,179,177,175,173,171,168,166,164,162,160,158,156,154,152,151,149,147,145,143,140,138,136,134,132,130,128,},
+{127,130,132,134,136,138,140,143,145,147,149,151,152,154,156,158,160,162,164,166,168,171,173,175,177,179,182,184,186,188,190,193,195,197,199,201,203,204,206,208,210,212,214,216,218,220,222,224,227,229,231,234,236,239,241,243,246,248,249,251,252,254,254,255,255,255,254,254,252,251,249,248,246,243,241,239,236,234,231,229,227,224,222,220,218,216,214,212,210,208,206,204,203,201,199,197,195,193,190,188,186,184,182,179,177,175,173,171,168,166,164,162,160,158,156,154,152,151,149,147,145,143,140,138,136,134,132,130,128,},
+{127,130,132,134,136,138,140,143,145,147,149,151,152,154,156,158,160,162,164,166,168,171,173,175,177,179,182,184,186,188,190,193,195,197,199,201,203,204,206,208,210,212,214,216,218,220,222,224,227,229,231,234,236,239,241,243,246,248,249,251,252,254,254,255,255,255,254,254,252,251,249,248,246,243,241,239,236,234,231,229,227,224,222,220,218,216,214,212,210,208,206,204,203,201,199,197,195,193,190,188,186,184,182,179,177,175,173,171,168,166,164,162,160,158,156,154,152,151,149,147,145,143,140,138,136,134,132,130,128,},
+{127,130,132,134,136,138,140,143,145,147,149,151,152,154,156,158,160,162,164,166,168,171,173,175,177,179,182,184,186,188,190,193,195,197,199,201,203,204,206,208,210,212,214,216,218,220,222,224,227,229,231,234,236,239,241,243,246,248,249,251,252,254,254,255,255,255,254,254,252,251,249,248,246,243,241,239,236,234,231,229,227,224,222,220,218,216,214,212,210,208,206,204,203,201,199,197,195,193,190,188,186,184,182,179,177,175,173,171,168,166,164,162,160,158,156,154,152,151,149,147,145,143,140,138,136,134,132,130,128,},
+{127,130,132,134,136,138,140,143,145,147,149,151,152,154,156,158,160,162,164,166,168,171,173,175,177,179,182,184,186,188,190,193,195,197,199,201,203,204,206,208,210,212,214,216,218,220,222,224,227,229,231,234,236,239,241,243,246,248,249,251,252,254,254,255,255,255,254,254,252,251,249,248,246,243,241,239,236,234,231,229,227,224,222,220,218,216,214,212,210,208,206,204,203,201,199,197,195,193,190,188,186,184,182,179,177,175,173,171,168,166,164,162,160,158,156,154,152,151,149,147,145,143,140,138,136,134,132,130,128,},
+{127,130,132,134,136,138,140,143,145,147,149,151,152,154,156,158,160,162,164,166,168,171,173,175,177,179,182,184,186,188,190,193,195,197,199,201,203,204,206,208,210,212,214,216,218,220,222,224,227,229,231,234,236,239,241,243,246,248,249,251,252,254,254,255,255,255,254,254,252,251,249,248,246,243,241,239,236,234,231,229,227,224,222,220,218,216,214,212,210,208,206,204,203,201,199,197,195,193,190,188,186,184,182,179,177,175,173,171,168,166,164,162,160,158,156,154,152,151,149,147,145,143,140,138,136,134,132,130,128,},
+{127,130,132,134,136,138,140,143,145,147,149,151,152,154,156,158,160,162,164,166,168,171,173,175,177,179,182,184,186,188,190,193,195,197,199,201,203,204,206,208,210,212,214,216,218,220,222,224,227,229,231,234,236,239,241,243,246,248,249,251,252,254,254,255,255,255,254,254,252,251,249,248,246,243,241,239,236,234,231,229,227,224,222,220,218,216,214,212,210,208,206,204,203,201,199,197,195,193,190,188,186,184,182,179,177,175,173,171,168,166,164,162,160,158,156,154,152,151,149,147,145,143,140,138,136,134,132,130,128,},
+{127,130,132,134,136,138,140,143,145,147,149,151,152,154,156,158,160,162,164,166,168,171,173,175,177,179,182,184,186,188,190,193,195,197,199,201,203,204,206,208,210,212,214,216,218,220,222,224,227,229,231,234,236,239,241,243,246,248,249,251,252,254,254,255,255,255,254,254,252,251,249,248,246,243,241,239,236,234,231,229,227,224,222,220,218,216,214,212,210,208,206,204,203,201,199,197,195,193,190,188,186,184,182,179,177,175,173,171,168,166,164,162,160,158,156,154,152,151,149,147,145,143,140,138,136,134,132,130,128,},
+{127,130,132,134,136,138,140,143,145,147,149,151,152,154,156,158,160,162,164,166,168,171,173,175,177,179,182,184,186,188,190,193,195,197,199,201,203,204,206,208,210,212,214,216,218,220,222,224,227,229,231,234,236,239,241,243,246,248,249,251,252,254,254,255,255,255,254,254,252,251,249,248,246,243,241,239,236,234,231,229,227,224,222,220,218,216,214,212,210,208,206,204,203,201,199,197,195,193,190,188,186,184,182,179,177,175,173,171,168,166,164,162,160,158,156,154,152,151,149,147,145,143,140,138,136,134,132,130,128,},
+{127,130,132,134,136,138,140,143,145,147,149,151,152,154,156,158,160,162,164,166,168,171,173,175,177,179,182,184,186,188,190,193,195,197,199,201,203,204,206,208,210,212,214,216,218,220,222,224,227,229,231,234,236,239,241,243,246,248,249,251,252,254,254,255,255,255,254,254,252,251,249,248,246,243,241,239,236,234,231,229,227,224,222,220,218,216,214,212,210,208,206,204,203,201,199,197,195,193,190,188,186,184,182,179,177,175,173,171,168,166,164,162,160,158,156,154,152,151,149,147,145,143,140,138,136,134,132,130,128,},
+{127,130,132,134,136,138,140,143,145,147,149,151,152,154,156,158,160,162,164,166,168,171,173,175,177,179,182,184,186,188,190,193,195,197,199,201,203,204,206,208,210,212,214,216,218,220,222,224,227,229,231,234,236,239,241,243,246,248,249,251,252,254,254,255,255,255,254,254,252,251,249,248,246,243,241,239,236,234,231,229,227,224,222,220,218,216,214,212,210,208,206,204,203,201,199,197,195,193,190,188,186,184,182,179,177,175,173,171,168,166,164,162,160,158,156,154,152,151,149,147,145,143,140,138,136,134,132,130,128,},
+{127,130,132,134,136,138,140,143,145,147,149,151,152,154,156,158,160,162,164,166,168,171,173,175,177,179,182,184,186,188,190,193,195,197,199,201,203,204,206,208,210,212,214,216,218,220,222,224,227,229,231,234,236,239,241,243,246,248,249,251,252,254,254,255,255,255,254,254,252,251,249,248,246,243,241,239,236,234,231,229,227,224,222,220,218,216,214,212,210,208,206,204,203,201,199,197,195,193,190,188,186,184,182,179,177,175,173,171,168,166,164,162,160,158,156,154,152,151,149,147,145,143,140,138,136,134,132,130,128,},
+{127,130,132,134,136,138,140,143,145,147,149,151,152,154,156,158,160,162,164,166,168,171,173,175,177,179,182,184,186,188,190,193,195,197,199,201,203,204,206,208,210,212,214,216,218,220,222,224,227,229,231,234,236,239,241,243,246,248,249,251,252,254,254,255,255,255,254,254,252,251,249,248,246,243,241,239,236,234,231,229,227,224,222,220,218,216,214,212,210,208,206,204,203,201,199,197,195,193,190,188,186,184,182,179,177,175,173,171,168,166,164,162,160,158,156,154,152,151,149,147,145,143,140,138,136,134,132,130,128,},
+{127,130,132,134,136,138,140,143,145,147,149,151,152,154,156,158,160,162,164,166,168,171,173,175,177,179,182,184,186,188,190,193,195,197,199,201,203,204,206,208,210,212,214,216,218,220,222,224,227,229,231,234,236,239,241,243,246,248,249,251,252,254,254,255,255,255,254,254,252,251,249,248,246,243,241,239,236,234,231,229,227,224,222,220,218,216,214,212,210,208,206,204,203,201,199,197,195,193,190,188,186,184,182,179,177,175,173,171,168,166,164,162,160,158,156,154,152,151,149,147,145,143,140,138,136,134,132,130,128,},
+{127,130,132,134,136,138,140,143,145,147,149,151,152,154,156,158,160,162,164,166,168,171,173,175,177,179,182,184,186,188,190,193,195,197,199,201,203,204,206,208,210,212,214,216,218,220,222,224,227,229,231,234,236,239,241,243,246,248,249,251,252,254,254,255,255,255,254,254,252,251,249,248,246,243,241,239,236,234,231,229,227,224,222,220,218,216,214,212,210,208,206,204,203,201,199,197,195,193,190,188,186,184,182,179,177,175,173,171,168,166,164,162,160,158,156,154,152,151,149,147,145,143,140,138,136,134,132,130,128,},
+{127,130,132,134,136,138,140,143,145,147,149,151,152,154,156,158,160,162,164,166,168,171,173,175,177,179,182,184,186,188,190,193,195,197,199,201,203,204,206,208,210,212,214,216,218,220,222,224,227,229,231,234,236,239,241,243,246,248,249,251,252,254,254,255,255,255,254,254,252,251,249,248,246,243,241,239,236,234,231,229,227,224,222,220,218,216,214,212,210,208,206,204,203,201,199,197,195,193,190,188,186,184,182,179,177,175,173,171,168,166,164,162,160,158,156,154,152,151,149,147,145,143,140,138,136,134,132,130,128,},
+{127,130,132,134,136,138,140,143,145,147,149,151,152,154,156,158,160,162,164,166,168,171,173,175,177,179,182,184,186,188,190,193,195,197,199,201,203,204,206,208,210,212,214,216,218,220,222,224,227,229,231,234,236,239,241,243,246,248,249,251,252,254,254,255,255,255,254,254,252,251,249,248,246,243,241,239,236,234,231,229,227,224,222,220,218,216,214,212,210,208,206,204,203,201,199,197,195,193,190,188,186,184,182,179,177,175,173,171,168,166,164,162,160,158,156,154,152,151,149,147,145,143,140,138,136,134,132,130,128,},
+{127,129,131,133,135,137,139,141,143,146,148,150,152,154,157,159,161,163,166,168,170,172,175,177,179,181,183,185,187,189,191,193,194,196,198,200,202,204,206,208,210,212,215,217,219,222,224,226,229,231,234,236,239,241,243,245,247,249,250,252,253,254,254,255,255,255,254,254,253,252,250,249,247,245,243,241,239,236,234,231,229,226,224,222,219,217,215,212,210,208,206,204,202,200,198,196,194,193,191,189,187,185,183,181,179,177,175,172,170,168,166,163,161,159,157,154,152,150,148,146,143,141,139,137,135,133,131,129,128,},
+{127,130,132,135,137,139,141,144,146,148,150,152,155,157,159,161,163,165,166,168,170,172,174,176,178,180,182,184,186,188,190,192,194,196,198,201,203,205,208,210,213,215,218,220,223,225,228,230,233,235,237,240,242,244,246,247,249,250,251,253,253,254,255,255,255,255,255,254,253,253,251,250,249,247,246,244,242,240,237,235,233,230,228,225,223,220,218,215,213,210,208,205,203,201,198,196,194,192,190,188,186,184,182,180,178,176,174,172,170,168,166,165,163,161,159,157,155,152,150,148,146,144,141,139,137,135,132,130,128,},
+{127,130,132,135,137,139,141,144,146,148,150,152,155,157,159,161,163,165,166,168,170,172,174,176,178,180,182,184,186,188,190,192,194,196,198,201,203,205,208,210,213,215,218,220,223,225,228,230,233,235,237,240,242,244,246,247,249,250,251,253,253,254,255,255,255,255,255,254,253,253,251,250,249,247,246,244,242,240,237,235,233,230,228,225,223,220,218,215,213,210,208,205,203,201,198,196,194,192,190,188,186,184,182,180,178,176,174,172,170,168,166,165,163,161,159,157,155,152,150,148,146,144,141,139,137,135,132,130,128,},
+{127,129,131,133,135,137,139,141,143,145,147,149,151,153,155,157,160,162,164,167,169,171,174,176,179,181,184,186,189,192,194,197,200,202,205,208,210,213,215,218,220,223,225,228,230,232,234,236,238,240,242,244,245,247,248,250,251,252,253,253,254,254,255,255,255,255,255,254,254,253,253,252,251,250,248,247,245,244,242,240,238,236,234,232,230,228,225,223,220,218,215,213,210,208,205,202,200,197,194,192,189,186,184,181,179,176,174,171,169,167,164,162,160,157,155,153,151,149,147,145,143,141,139,137,135,133,131,129,128,},
+{127,129,131,133,135,137,139,141,143,145,147,149,151,153,155,157,160,162,164,167,169,171,174,176,179,181,184,186,189,192,194,197,200,202,205,208,210,213,215,218,220,223,225,228,230,232,234,236,238,240,242,244,245,247,248,250,251,252,253,253,254,254,255,255,255,255,255,254,254,253,253,252,251,250,248,247,245,244,242,240,238,236,234,232,230,228,225,223,220,218,215,213,210,208,205,202,200,197,194,192,189,186,184,181,179,176,174,171,169,167,164,162,160,157,155,153,151,149,147,145,143,141,139,137,135,133,131,129,128,},
+{127,131,134,137,140,143,146,149,152,155,158,162,165,167,170,173,176,179,182,185,188,190,193,196,198,201,203,206,208,211,213,215,218,220,222,224,226,228,230,232,234,235,237,238,240,241,243,244,245,246,248,249,250,250,251,252,253,253,254,254,254,255,255,255,255,255,255,255,254,254,254,253,253,252,251,250,250,249,248,246,245,244,243,241,240,238,237,235,234,232,230,228,226,224,222,220,218,215,213,211,208,206,203,201,198,196,193,190,188,185,182,179,176,173,170,167,165,162,158,155,152,149,146,143,140,137,134,131,128,},
+{127,131,134,137,140,143,146,149,152,155,158,162,165,167,170,173,176,179,182,185,188,190,193,196,198,201,203,206,208,211,213,215,218,220,222,224,226,228,230,232,234,235,237,238,240,241,243,244,245,246,248,249,250,250,251,252,253,253,254,254,254,255,255,255,255,255,255,255,254,254,254,253,253,252,251,250,250,249,248,246,245,244,243,241,240,238,237,235,234,232,230,228,226,224,222,220,218,215,213,211,208,206,203,201,198,196,193,190,188,185,182,179,176,173,170,167,165,162,158,155,152,149,146,143,140,137,134,131,128,},
+{127,131,134,137,140,143,146,149,152,155,158,162,165,167,170,173,176,179,182,185,188,190,193,196,198,201,203,206,208,211,213,215,218,220,222,224,226,228,230,232,234,235,237,238,240,241,243,244,245,246,248,249,250,250,251,252,253,253,254,254,254,255,255,255,255,255,255,255,254,254,254,253,253,252,251,250,250,249,248,246,245,244,243,241,240,238,237,235,234,232,230,228,226,224,222,220,218,215,213,211,208,206,203,201,198,196,193,190,188,185,182,179,176,173,170,167,165,162,158,155,152,149,146,143,140,137,134,131,128,},
+{127,131,134,137,140,143,146,149,152,155,158,162,165,167,170,173,176,179,182,185,188,190,193,196,198,201,203,206,208,211,213,215,218,220,222,224,226,228,230,232,234,235,237,238,240,241,243,244,245,246,248,249,250,250,251,252,253,253,254,254,254,255,255,255,255,255,255,255,254,254,254,253,253,252,251,250,250,249,248,246,245,244,243,241,240,238,237,235,234,232,230,228,226,224,222,220,218,215,213,211,208,206,203,201,198,196,193,190,188,185,182,179,176,173,170,167,165,162,158,155,152,149,146,143,140,137,134,131,128,},
+};
+
+//Half cycles of the band limited ramps, every harmonic. Read them with wavetable_half().
+const unsigned char G_AUC_RAMP_WAVETABLE_LUT [WAVETABLE_BANK_ROWS] [WAVETABLE_HALF_SIZE] PROGMEM = { 
+{127,255,224,241,228,236,228,234,227,231,226,229,224,227,223,225,221,223,220,221,218,220,217,218,215,216,213,214,212,212,210,211,208,209,207,207,205,205,204,204,202,202,200,200,198,199,197,197,195,195,193,193,192,192,190,190,188,188,187,186,185,185,183,183,182,181,180,180,178,178,177,176,175,174,173,173,172,171,170,169,168,168,166,166,165,164,163,163,161,161,160,159,158,157,156,156,155,154,153,152,151,151,150,149,148,147,146,145,144,144,143,142,141,140,139,139,138,137,136,135,134,133,133,132,131,130,129,128,128,},
+{127,255,224,241,228,236,228,234,227,231,226,229,224,227,223,225,221,223,220,221,218,220,217,218,215,216,213,214,212,212,210,211,208,209,207,207,205,205,204,204,202,202,200,200,198,199,197,197,195,195,193,193,192,192,190,190,188,188,187,186,185,185,183,183,182,181,180,180,178,178,177,176,175,174,173,173,172,171,170,169,168,168,166,166,165,164,163,163,161,161,160,159,158,157,156,156,155,154,153,152,151,151,150,149,148,147,146,145,144,144,143,142,141,140,139,139,138,137,136,135,134,133,133,132,131,130,129,128,128,},
+{127,255,224,241,228,236,228,234,227,231,226,229,224,227,223,225,221,223,220,221,218,220,217,218,215,216,213,214,212,212,210,211,208,209,207,207,205,205,204,204,202,202,200,200,198,199,197,197,195,195,193,193,192,192,190,190,188,188,187,186,185,185,183,183,182,181,180,180,178,178,177,176,175,174,173,173,172,171,170,169,168,168,166,166,165,164,163,163,161,161,160,159,158,157,156,156,155,154,153,152,151,151,150,149,148,147,146,145,144,144,143,142,141,140,139,139,138,137,136,135,134,133,133,132,131,130,129,128,128,},
+{127,255,224,241,228,236,228,234,227,231,226,229,224,227,223,225,221,223,220,221,218,220,217,218,215,216,213,214,212,212,210,211,208,209,207,207,205,205,204,204,202,202,200,200,198,199,197,197,195,195,193,193,192,192,190,190,188,188,187,186,185,185,183,183,182,181,180,180,178,178,177,176,175,174,173,173,172,171,170,169,168,168,166,166,165,164,163,163,161,161,160,159,158,157,156,156,155,154,153,152,151,151,150,149,148,147,146,145,144,144,143,142,141,140,139,139,138,137,136,135,134,133,133,132,131,130,129,128,128,},
+{127,255,224,241,228,236,228,234,227,231,226,229,224,227,223,225,221,223,220,221,218,220,217,218,215,216,213,214,212,212,210,211,208,209,207,207,205,205,204,204,202,202,200,200,198,199,197,197,195,195,193,193,192,192,190,190,188,188,187,186,185,185,183,183,182,181,180,180,178,178,177,176,175,174,173,173,172,171,170,169,168,168,166,166,165,164,163,163,161,161,160,159,158,157,156,156,155,154,153,152,151,151,150,149,148,147,146,145,144,144,143,142,141,140,139,139,138,137,136,135,134,133,133,132,131,130,129,128,128,},
+{127,255,224,241,228,236,228,234,227,231,226,229,224,227,223,225,221,223,220,221,218,220,217,218,215,216,213,214,212,212,210,211,208,209,207,207,205,205,204,204,202,202,200,200,198,199,197,197,195,195,193,193,192,192,190,190,188,188,187,186,185,185,183,183,182,181,180,180,178,178,177,176,175,174,173,173,172,171,170,169,168,168,166,166,165,164,163,163,161,161,160,159,158,157,156,156,155,154,153,152,151,151,150,149,148,147,146,145,144,144,143,142,141,140,139,139,138,137,136,135,134,133,133,132,131,130,129,128,128,},
+{127,255,224,241,228,236,228,234,227,231,226,229,224,227,223,225,221,223,220,221,218,220,217,218,215,216,213,214,212,212,210,211,208,209,207,207,205,205,204,204,202,202,200,200,198,199,197,197,195,195,193,193,192,192,190,190,188,188,187,186,185,185,183,183,182,181,180,180,178,178,177,176,175,174,173,173,172,171,170,169,168,168,166,166,165,164,163,163,161,161,160,159,158,157,156,156,155,154,153,152,151,151,150,149,148,147,146,145,144,144,143,142,141,140,139,139,138,137,136,135,134,133,133,132,131,130,129,128,128,},
+{127,255,224,241,228,236,228,234,227,231,226,229,224,227,223,225,221,223,220,221,218,220,217,218,215,216,213,214,212,212,210,211,208,209,207,207,205,205,204,204,202,202,200,200,198,199,197,197,195,195,193,193,192,192,190,190,188,188,187,186,185,185,183,183,182,181,180,180,178,178,177,176,175,174,173,173,172,171,170,169,168,168,166,166,165,164,163,163,161,161,160,159,158,157,156,156,155,154,153,152,151,151,150,149,148,147,146,145,144,144,143,142,141,140,139,139,138,137,136,135,134,133,133,132,131,130,129,128,128,},
+{127,255,224,241,228,236,228,234,227,231,226,229,224,227,223,225,221,223,220,221,218,220,217,218,215,216,213,214,212,212,210,211,208,209,207,207,205,205,204,204,202,202,200,200,198,199,197,197,195,195,193,193,192,192,190,190,188,188,187,186,185,185,183,183,182,181,180,180,178,178,177,176,175,174,173,173,172,171,170,169,168,168,166,166,165,164,163,163,161,161,160,159,158,157,156,156,155,154,153,152,151,151,150,149,148,147,146,145,144,144,143,142,141,140,139,139,138,137,136,135,134,133,133,132,131,130,129,128,128,},
+{127,255,224,241,228,236,228,234,227,231,226,229,224,227,223,225,221,223,220,221,218,220,217,218,215,216,213,214,212,212,210,211,208,209,207,207,205,205,204,204,202,202,200,200,198,199,197,197,195,195,193,193,192,192,190,190,188,188,187,186,185,185,183,183,182,181,180,180,178,178,177,176,175,174,173,173,172,171,170,169,168,168,166,166,165,164,163,163,161,161,160,159,158,157,156,156,155,154,153,152,151,151,150,149,148,147,146,145,144,144,143,142,141,140,139,139,138,137,136,135,134,133,133,132,131,130,129,128,128,},
+{127,255,224,241,228,236,228,234,227,231,226,229,224,227,223,225,221,223,220,221,218,220,217,218,215,216,213,214,212,212,210,211,208,209,207,207,205,205,204,204,202,202,200,200,198,199,197,197,195,195,193,193,192,192,190,190,188,188,187,186,185,185,183,183,182,181,180,180,178,178,177,176,175,174,173,173,172,171,170,169,168,168,166,166,165,164,163,163,161,161,160,159,158,157,156,156,155,154,153,152,151,151,150,149,148,147,146,145,144,144,143,142,141,140,139,139,138,137,136,135,134,133,133,132,131,130,129,128,128,},
+{127,255,224,241,228,236,228,234,227,231,226,229,224,227,223,225,221,223,220,221,218,220,217,218,215,216,213,214,212,212,210,211,208,209,207,207,205,205,204,204,202,202,200,200,198,199,197,197,195,195,193,193,192,192,190,190,188,188,187,186,185,185,183,183,182,181,180,180,178,178,177,176,175,174,173,173,172,171,170,169,168,168,166,166,165,164,163,163,161,161,160,159,158,157,156,156,155,154,153,152,151,151,150,149,148,147,146,145,144,144,143,142,141,140,139,139,138,137,136,135,134,133,133,132,131,130,129,128,128,},
+{127,255,234,235,241,230,239,231,233,233,229,232,227,230,227,226,227,223,225,222,222,222,219,221,218,218,217,215,216,213,214,212,211,211,209,210,208,207,207,205,205,203,203,202,201,201,199,199,197,196,196,194,195,193,192,192,190,190,188,188,187,186,186,184,184,183,182,181,180,180,178,177,177,175,175,174,173,172,171,171,169,169,168,167,166,165,165,163,163,162,160,160,159,158,157,156,156,154,154,153,152,151,150,150,148,148,147,146,145,144,143,142,141,141,139,139,138,137,136,135,135,133,133,132,131,130,129,129,128,},
+{127,248,255,230,243,245,233,239,241,232,235,237,231,232,234,229,229,231,227,226,228,224,223,225,222,221,222,219,218,219,217,215,216,214,212,213,212,210,210,209,207,208,206,204,205,204,202,202,201,199,199,198,196,196,196,193,193,193,191,190,190,188,188,187,185,185,185,183,182,182,180,179,179,177,176,176,175,174,174,172,171,171,169,168,168,167,165,165,164,163,162,161,160,160,159,157,157,156,154,154,153,152,151,151,149,148,148,146,146,145,144,143,143,141,140,140,138,137,137,136,135,134,133,132,132,130,129,129,128,},
+{127,225,255,235,223,235,239,229,226,232,232,226,224,228,227,222,222,225,223,219,219,221,219,216,216,218,215,212,213,214,211,209,210,210,207,206,207,206,204,203,204,203,200,200,200,199,197,197,197,195,193,193,194,192,190,190,190,188,187,187,186,185,183,184,183,181,180,180,179,177,177,177,176,174,174,174,172,171,170,170,169,167,167,167,165,164,164,163,161,160,161,160,158,157,157,156,154,154,154,152,151,151,150,149,148,147,147,145,144,144,143,142,141,141,140,138,137,137,136,135,134,134,133,131,131,131,129,128,128,},
+{127,211,255,253,233,225,233,241,238,230,226,231,234,231,226,224,227,229,226,222,221,223,224,221,217,217,219,219,216,213,213,214,214,211,209,209,210,209,207,205,205,206,205,202,200,201,201,200,197,196,196,197,195,193,192,192,192,191,189,188,188,188,186,184,183,184,183,181,180,179,179,179,177,175,175,175,174,172,171,171,171,170,168,166,166,166,165,163,162,162,162,161,159,158,158,157,156,154,153,153,153,152,150,149,149,149,147,145,145,145,144,142,141,140,140,140,138,137,136,136,135,133,132,132,132,131,129,128,128,},
+{127,194,240,255,247,231,222,225,233,237,235,228,222,222,226,229,228,223,219,218,220,222,222,219,215,214,215,216,216,214,211,209,209,211,211,209,206,204,204,205,205,204,201,199,199,200,200,199,196,194,194,194,194,193,191,189,188,189,189,188,186,184,183,183,184,183,181,179,178,178,178,178,176,174,173,173,173,173,171,169,168,167,167,167,166,164,163,162,162,162,161,159,158,157,157,157,156,154,153,152,151,151,151,149,148,146,146,146,146,144,143,141,141,141,140,139,138,136,136,135,135,134,133,131,130,130,130,129,128,},
+{127,183,226,250,255,246,233,223,221,226,232,236,235,230,224,220,220,223,226,227,225,221,217,215,215,217,219,219,216,213,210,209,210,211,212,211,208,205,203,203,204,205,204,203,200,198,197,197,197,198,197,195,193,191,190,190,191,191,190,188,186,184,184,184,184,184,182,180,179,177,177,177,177,177,175,173,171,171,171,171,170,169,168,166,165,164,164,164,163,162,160,159,158,157,157,157,156,155,153,152,151,151,151,150,149,148,146,145,144,144,144,143,142,140,139,138,137,137,137,136,135,133,132,131,131,131,130,129,128,},
+{127,172,210,238,252,255,249,238,228,222,220,223,227,232,234,233,230,225,220,217,217,218,221,223,223,221,218,215,212,210,210,211,213,213,213,211,209,206,204,202,203,203,204,204,203,202,199,197,195,194,195,195,196,195,194,192,190,188,187,186,186,187,187,186,185,183,181,179,178,178,178,178,178,177,176,174,172,170,170,170,170,170,169,168,167,165,163,162,161,161,161,161,160,159,157,156,154,153,153,153,153,152,152,150,148,147,145,145,144,144,144,144,143,141,139,138,137,136,136,136,136,135,134,132,130,129,128,128,128,},
+{127,162,194,220,240,251,255,253,246,238,230,223,219,218,220,223,227,230,231,231,229,225,221,217,214,213,212,213,215,217,218,218,216,214,211,208,206,204,203,203,204,205,205,206,205,203,201,199,196,194,193,193,193,193,194,194,194,193,191,189,187,185,183,182,182,182,183,183,183,182,180,179,177,175,173,172,171,171,171,172,172,171,170,168,167,165,163,162,161,160,160,161,160,160,159,158,156,155,153,151,150,150,149,149,149,149,149,148,146,144,143,141,140,139,139,138,138,138,138,137,136,134,133,131,129,128,128,128,128,},
+{127,156,183,206,226,241,250,255,255,252,246,239,232,225,220,217,217,217,219,222,225,227,229,229,228,225,222,219,215,212,210,208,208,208,209,210,212,212,212,212,210,208,206,203,200,198,197,196,196,196,196,197,197,198,197,196,195,193,190,188,186,184,183,183,182,183,183,183,183,183,182,181,179,177,175,173,172,170,169,169,169,169,169,169,169,168,167,166,164,163,161,159,157,156,156,155,155,155,155,155,155,154,153,151,150,148,146,144,143,142,142,141,141,141,141,141,140,139,138,137,135,133,131,130,129,128,128,128,128,},
+{127,151,173,194,212,227,239,248,253,255,254,251,246,240,234,228,223,219,216,214,214,215,217,219,221,223,225,225,225,224,223,220,217,214,211,208,206,204,203,202,202,203,203,204,205,206,206,205,204,203,201,199,196,194,192,190,188,187,187,186,187,187,187,188,188,188,187,186,185,183,181,179,177,175,173,172,171,170,170,170,170,170,170,170,170,169,168,167,166,164,162,160,158,157,155,154,154,153,153,153,153,153,153,153,152,151,150,148,146,145,143,141,140,138,137,137,136,136,136,136,136,136,135,135,134,132,131,129,128,},
+{127,146,164,181,196,211,223,234,242,249,253,255,255,254,251,247,242,238,232,227,223,219,216,213,211,211,210,211,212,214,215,217,218,219,220,220,220,219,218,216,213,211,208,205,203,200,198,196,195,194,193,193,193,193,194,194,195,195,195,195,195,194,193,192,190,188,186,184,182,180,178,176,175,173,173,172,172,172,172,172,172,172,172,172,172,171,170,169,167,166,164,162,160,158,156,155,153,152,151,151,150,150,150,150,150,150,150,150,149,149,148,147,145,144,142,140,138,137,135,133,132,130,129,129,128,128,128,128,128,},
+{127,142,157,171,185,198,209,220,229,237,243,248,252,254,255,255,253,251,248,244,240,236,231,227,223,219,216,213,210,208,207,206,206,206,207,208,209,210,211,212,213,214,214,214,214,213,212,211,209,207,205,203,200,198,195,193,191,189,187,186,184,184,183,183,183,183,183,183,184,184,184,184,184,184,183,183,182,180,179,177,176,174,172,170,168,166,164,162,161,159,158,157,156,156,156,156,155,155,156,156,156,156,155,155,154,154,153,152,150,149,147,145,143,142,140,138,136,134,133,132,131,130,129,128,128,128,128,128,128,},
+{127,139,151,162,173,183,193,203,212,220,227,233,239,244,248,251,253,254,255,255,254,253,251,248,245,242,238,235,231,227,224,220,217,214,211,208,206,204,202,201,200,199,199,199,199,200,200,201,201,202,203,204,204,205,205,205,205,204,204,203,202,201,199,197,196,194,192,189,187,185,183,180,178,176,174,173,171,170,169,168,167,166,166,165,165,165,165,165,165,165,165,165,165,165,165,165,164,164,163,162,161,159,158,156,155,153,151,149,147,145,143,141,140,138,136,135,133,132,131,130,129,129,128,128,128,128,128,128,128,},
+{127,137,147,157,166,176,185,193,201,209,216,223,229,234,239,243,247,250,252,253,255,255,255,254,253,252,250,247,245,242,239,236,232,229,226,222,219,216,213,210,207,204,202,200,198,197,196,195,194,193,193,193,193,193,193,194,194,195,195,196,196,197,197,197,197,197,197,197,196,195,194,193,192,191,189,187,185,183,181,179,177,175,173,171,169,167,165,163,161,159,158,156,155,154,153,152,152,151,151,151,150,150,150,150,150,150,150,150,150,150,150,150,149,149,148,148,147,146,145,143,142,140,139,137,135,133,131,129,128,},
+{127,136,144,152,160,168,175,183,190,197,204,210,216,221,226,231,236,239,243,246,249,251,252,254,255,255,255,255,254,253,252,250,248,246,243,241,238,235,232,229,226,223,220,217,214,211,208,205,203,200,198,196,194,192,190,189,187,186,185,185,184,184,183,183,183,183,183,184,184,184,184,185,185,185,186,186,186,186,186,186,185,185,184,184,183,182,181,180,179,177,176,174,172,170,168,167,164,162,160,158,156,154,152,150,148,146,144,142,141,139,137,136,135,134,133,132,131,130,129,129,129,128,128,128,128,128,128,128,128,},
+{127,134,140,147,153,160,166,172,178,184,190,195,200,206,211,215,220,224,228,232,235,238,241,244,246,248,250,252,253,254,254,255,255,255,254,254,253,252,251,249,248,246,244,242,239,237,234,232,229,226,224,221,218,215,212,209,207,204,201,198,196,193,191,189,186,184,182,180,179,177,175,174,173,172,171,170,169,168,168,167,167,166,166,166,166,166,166,166,166,166,166,166,166,166,167,167,167,167,167,166,166,166,166,165,165,164,163,163,162,161,160,159,157,156,155,153,151,150,148,146,144,142,140,138,136,134,132,130,128,},
+{127,132,137,142,147,151,156,161,165,170,174,179,183,188,192,196,200,204,207,211,215,218,221,224,227,230,233,235,238,240,242,244,246,248,249,250,252,252,253,254,254,255,255,255,255,255,254,254,253,252,251,250,249,247,246,244,243,241,239,237,235,233,230,228,226,223,221,218,216,213,210,208,205,202,200,197,194,191,189,186,183,181,178,176,173,171,168,166,164,162,159,157,155,153,151,150,148,146,145,143,142,140,139,138,137,136,135,134,133,132,132,131,130,130,129,129,129,128,128,128,128,128,128,128,128,128,128,128,128,},
+{127,132,137,142,147,151,156,161,165,170,174,179,183,188,192,196,200,204,207,211,215,218,221,224,227,230,233,235,238,240,242,244,246,248,249,250,252,252,253,254,254,255,255,255,255,255,254,254,253,252,251,250,249,247,246,244,243,241,239,237,235,233,230,228,226,223,221,218,216,213,210,208,205,202,200,197,194,191,189,186,183,181,178,176,173,171,168,166,164,162,159,157,155,153,151,150,148,146,145,143,142,140,139,138,137,136,135,134,133,132,132,131,130,130,129,129,129,128,128,128,128,128,128,128,128,128,128,128,128,},
+{127,131,134,137,140,143,146,149,152,155,158,162,165,167,170,173,176,179,182,185,188,190,193,196,198,201,203,206,208,211,213,215,218,220,222,224,226,228,230,232,234,235,237,238,240,241,243,244,245,246,248,249,250,250,251,252,253,253,254,254,254,255,255,255,255,255,255,255,254,254,254,253,253,252,251,250,250,249,248,246,245,244,243,241,240,238,237,235,234,232,230,228,226,224,222,220,218,215,213,211,208,206,203,201,198,196,193,190,188,185,182,179,176,173,170,167,165,162,158,155,152,149,146,143,140,137,134,131,128,},
+{127,131,134,137,140,143,146,149,152,155,158,162,165,167,170,173,176,179,182,185,188,190,193,196,198,201,203,206,208,211,213,215,218,220,222,224,226,228,230,232,234,235,237,238,240,241,243,244,245,246,248,249,250,250,251,252,253,253,254,254,254,255,255,255,255,255,255,255,254,254,254,253,253,252,251,250,250,249,248,246,245,244,243,241,240,238,237,235,234,232,230,228,226,224,222,220,218,215,213,211,208,206,203,201,198,196,193,190,188,185,182,179,176,173,170,167,165,162,158,155,152,149,146,143,140,137,134,131,128,},
+};
+
+//The scanning bank for WAVETABLE_SCAN, 16 single cycles of 16 harmonics or fewer. With 16
+//harmonics the frames are clean up to about C6 (MIDI note 84).
+const unsigned char G_AUC_SCAN_WAVETABLE_LUT [WAVETABLE_SCAN_FRAMES] [256] PROGMEM = { 
+{128,131,134,137,140,144,147,150,153,156,159,162,165,168,171,174,177,179,182,185,188,191,193,196,199,201,204,206,209,211,213,216,218,220,222,224,226,228,230,232,234,235,237,239,240,241,243,244,245,246,248,249,250,250,251,252,253,253,254,254,254,255,255,255,255,255,255,255,254,254,254,253,253,252,251,250,250,249,248,246,245,244,243,241,240,239,237,235,234,232,230,228,226,224,222,220,218,216,213,211,209,206,204,201,199,196,193,191,188,185,182,179,177,174,171,168,165,162,159,156,153,150,147,144,140,137,134,131,128,125,122,119,116,112,109,106,103,100,97,94,91,88,85,82,79,77,74,71,68,65,63,60,57,55,52,50,47,45,43,40,38,36,34,32,30,28,26,24,22,21,19,17,16,15,13,12,11,10,8,7,6,6,5,4,3,3,2,2,2,1,1,1,1,1,1,1,2,2,2,3,3,4,5,6,6,7,8,10,11,12,13,15,16,17,19,21,22,24,26,28,30,32,34,36,38,40,43,45,47,50,52,55,57,60,63,65,68,71,74,77,79,82,85,88,91,94,97,100,103,106,109,112,116,119,122,125,},
+{128,133,138,142,147,152,157,161,166,170,175,179,184,188,192,196,200,204,208,211,215,218,221,224,227,230,233,236,238,240,242,244,246,248,249,250,252,252,253,254,254,255,255,255,255,255,254,254,253,252,251,250,249,247,246,244,243,241,239,237,235,233,230,228,226,223,221,218,216,213,211,208,205,202,200,197,194,192,189,186,184,181,179,176,174,171,169,166,164,162,160,158,156,154,152,150,148,147,145,144,142,141,139,138,137,136,135,134,133,133,132,131,131,130,130,130,129,129,129,129,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,127,127,127,127,126,126,126,125,125,124,123,123,122,121,120,119,118,117,115,114,112,111,109,108,106,104,102,100,98,96,94,92,90,87,85,82,80,77,75,72,70,67,64,62,59,56,54,51,48,45,43,40,38,35,33,30,28,26,23,21,19,17,15,13,12,10,9,7,6,5,4,3,2,2,1,1,1,1,1,2,2,3,4,4,6,7,8,10,12,14,16,18,20,23,26,29,32,35,38,41,45,48,52,56,60,64,68,72,77,81,86,90,95,99,104,109,114,118,123,},
+{128,134,141,147,154,160,166,172,178,184,190,195,201,206,211,215,220,224,228,232,235,238,241,244,246,248,250,252,253,254,254,255,255,255,254,254,253,252,251,249,248,246,244,242,239,237,234,232,229,226,224,221,218,215,212,210,207,204,201,199,196,194,191,189,187,185,183,181,179,177,176,174,173,172,171,170,169,168,168,167,167,167,166,166,166,166,166,166,166,166,166,167,167,167,167,167,167,167,167,167,167,166,166,166,165,164,164,163,162,161,160,159,158,156,155,153,152,150,148,147,145,143,141,139,137,134,132,130,128,126,124,122,119,117,115,113,111,109,108,106,104,103,101,100,98,97,96,95,94,93,92,92,91,90,90,90,89,89,89,89,89,89,89,89,89,89,90,90,90,90,90,90,90,90,90,89,89,89,88,88,87,86,85,84,83,82,80,79,77,75,73,71,69,67,65,62,60,57,55,52,49,46,44,41,38,35,32,30,27,24,22,19,17,14,12,10,8,7,5,4,3,2,2,1,1,1,2,2,3,4,6,8,10,12,15,18,21,24,28,32,36,41,45,50,55,61,66,72,78,84,90,96,102,109,115,122,},
+{128,136,144,152,160,168,176,183,190,197,204,210,216,221,227,231,236,240,243,246,249,251,252,254,255,255,255,255,254,253,252,250,248,246,243,241,238,235,232,229,226,223,220,217,214,211,208,205,203,200,198,196,194,192,190,189,188,187,186,185,184,184,184,184,183,183,184,184,184,184,185,185,185,186,186,186,186,186,186,186,186,185,185,184,183,182,181,180,179,177,176,174,173,171,169,167,165,163,161,159,156,154,152,150,148,146,144,143,141,139,138,137,135,134,133,132,131,131,130,129,129,129,128,128,128,128,128,128,128,128,128,128,128,128,128,127,127,127,126,125,125,124,123,122,121,119,118,117,115,113,112,110,108,106,104,102,100,97,95,93,91,89,87,85,83,82,80,79,77,76,75,74,73,72,71,71,70,70,70,70,70,70,70,70,71,71,71,72,72,72,72,73,73,72,72,72,72,71,70,69,68,67,66,64,62,60,58,56,53,51,48,45,42,39,36,33,30,27,24,21,18,15,13,10,8,6,4,3,2,1,1,1,1,2,4,5,7,10,13,16,20,25,29,35,40,46,52,59,66,73,80,88,96,104,112,120,},
+{128,140,151,162,173,184,193,203,212,220,227,234,239,244,248,251,253,254,255,255,254,253,251,248,245,242,239,235,231,227,224,220,217,214,211,208,206,204,202,201,200,200,199,199,199,200,200,201,202,202,203,204,204,205,205,205,205,205,204,203,202,201,199,198,196,194,192,190,187,185,183,181,179,177,175,173,171,170,169,168,167,166,166,166,165,165,165,165,166,166,166,166,166,166,165,165,165,164,163,162,161,160,158,157,155,153,151,150,148,146,144,142,140,138,137,135,134,133,132,131,130,129,129,128,128,128,128,128,128,128,128,128,128,128,127,127,126,125,124,123,122,121,119,118,116,114,112,110,108,106,105,103,101,99,98,96,95,94,93,92,91,91,91,90,90,90,90,90,90,91,91,91,91,90,90,90,89,88,87,86,85,83,81,79,77,75,73,71,69,66,64,62,60,58,57,55,54,53,52,51,51,51,51,51,52,52,53,54,54,55,56,56,57,57,57,56,56,55,54,52,50,48,45,42,39,36,32,29,25,21,17,14,11,8,5,3,2,1,1,2,3,5,8,12,17,22,29,36,44,53,63,72,83,94,105,116,},
+{128,143,157,172,185,198,210,220,229,237,243,248,252,254,255,255,253,251,248,244,240,236,232,227,223,219,216,213,210,209,207,207,206,207,207,208,209,210,211,213,213,214,215,215,214,214,213,211,209,207,205,203,200,198,195,193,191,189,187,186,185,184,183,183,183,183,183,184,184,184,184,184,184,184,184,183,182,181,179,178,176,174,172,170,168,166,164,162,161,160,158,158,157,156,156,156,156,156,156,156,156,156,156,155,155,154,153,152,151,149,147,146,144,142,140,138,137,135,133,132,131,130,129,129,128,128,128,128,128,128,128,128,128,127,127,126,125,124,123,121,119,118,116,114,112,110,109,107,105,104,103,102,101,101,100,100,100,100,100,100,100,100,100,100,99,98,98,96,95,94,92,90,88,86,84,82,80,78,77,75,74,73,72,72,72,72,72,72,72,72,73,73,73,73,73,72,71,70,69,67,65,63,61,58,56,53,51,49,47,45,43,42,42,41,41,42,43,43,45,46,47,48,49,49,50,49,49,47,46,43,40,37,33,29,24,20,16,12,8,5,3,1,1,2,4,8,13,19,27,36,46,58,71,84,99,113,},
+{128,148,167,185,202,217,229,240,247,252,255,255,253,250,246,241,236,230,225,221,217,214,213,212,212,213,215,216,218,220,221,222,222,222,221,219,217,215,212,209,206,204,201,200,198,197,197,197,197,198,198,199,199,200,200,199,198,197,196,194,192,189,187,185,183,181,180,179,178,178,178,178,178,179,179,179,179,178,177,176,175,173,171,169,167,166,164,162,161,160,159,158,158,158,158,158,158,158,158,158,157,156,155,153,151,150,148,146,144,143,141,140,139,139,138,138,138,138,138,138,138,137,137,136,135,133,132,130,128,126,124,123,121,120,119,119,118,118,118,118,118,118,118,117,117,116,115,113,112,110,108,106,105,103,101,100,99,98,98,98,98,98,98,98,98,98,97,96,95,94,92,90,89,87,85,83,81,80,79,78,77,77,77,77,78,78,78,78,78,77,76,75,73,71,69,67,64,62,60,59,58,57,56,56,57,57,58,58,59,59,59,59,58,56,55,52,50,47,44,41,39,37,35,34,34,34,35,36,38,40,41,43,44,44,43,42,39,35,31,26,20,15,10,6,3,1,1,4,9,16,27,39,54,71,89,108,},
+{128,156,183,206,226,241,250,255,255,252,246,239,232,225,221,218,217,217,220,222,225,228,229,229,228,225,222,219,215,212,210,208,208,208,209,211,212,212,213,212,210,208,206,203,201,199,197,196,196,196,197,197,198,198,197,196,195,193,191,188,186,185,184,183,183,183,183,183,183,183,182,181,180,178,176,174,172,171,170,169,169,169,169,169,169,169,168,166,165,163,161,159,158,157,156,156,156,156,156,155,155,154,153,152,150,148,146,145,144,143,142,142,142,142,142,141,141,140,139,137,135,134,132,130,129,129,128,128,128,128,128,127,127,126,124,122,121,119,117,116,115,115,114,114,114,114,114,113,112,111,110,108,106,104,103,102,101,101,100,100,100,100,100,99,98,97,95,93,91,90,88,87,87,87,87,87,87,87,86,85,84,82,80,78,76,75,74,73,73,73,73,73,73,73,72,71,70,68,65,63,61,60,59,58,58,59,59,60,60,60,59,57,55,53,50,48,46,44,43,44,44,45,47,48,48,48,46,44,41,37,34,31,28,27,27,28,31,34,36,39,39,38,35,31,24,17,10,4,1,1,6,15,30,50,73,100,},
+{128,156,182,206,225,240,250,255,255,252,246,240,233,226,222,219,218,219,221,224,227,229,231,231,230,228,225,222,218,215,213,212,211,212,213,214,215,216,217,216,215,213,211,208,206,204,202,201,201,201,202,203,203,204,204,203,202,200,198,196,194,192,191,190,190,190,191,191,191,191,191,190,189,187,185,183,182,180,179,179,178,179,179,179,179,179,178,178,176,175,173,171,169,168,167,167,167,167,167,167,167,167,166,165,164,162,161,159,157,156,155,154,154,154,155,155,155,156,155,155,153,151,149,146,143,140,136,132,128,124,120,116,113,110,107,105,103,101,101,100,101,101,101,102,102,102,101,100,99,97,95,94,92,91,90,89,89,89,89,89,89,89,89,88,87,85,83,81,80,78,78,77,77,77,77,77,78,77,77,76,74,73,71,69,67,66,65,65,65,65,65,66,66,66,65,64,62,60,58,56,54,53,52,52,53,53,54,55,55,55,54,52,50,48,45,43,41,40,39,40,41,42,43,44,45,44,43,41,38,34,31,28,26,25,25,27,29,32,35,37,38,37,34,30,23,16,10,4,1,1,6,16,31,50,74,100,},
+{128,156,182,205,225,239,249,254,255,252,247,241,234,228,223,220,220,220,222,225,228,231,233,234,233,231,229,226,222,220,217,216,215,216,217,218,220,221,222,222,221,219,217,215,213,211,209,208,208,208,209,210,211,211,212,211,210,209,207,205,203,202,200,200,199,200,200,201,202,202,202,201,201,199,198,196,194,193,191,191,191,191,191,192,192,193,193,192,191,190,188,186,185,183,182,181,181,181,182,182,183,184,184,183,182,181,179,177,175,173,172,171,171,171,172,173,175,176,177,177,177,175,172,167,161,154,146,137,128,119,110,102,95,89,84,81,79,79,79,80,81,83,84,85,85,85,84,83,81,79,77,75,74,73,72,72,73,74,74,75,75,75,74,73,71,70,68,66,65,64,63,63,64,64,65,65,65,65,65,63,62,60,58,57,55,55,54,54,54,55,56,56,57,56,56,54,53,51,49,47,46,45,44,45,45,46,47,48,48,48,47,45,43,41,39,37,35,34,34,35,36,38,39,40,41,40,39,36,34,30,27,25,23,22,23,25,28,31,34,36,36,36,33,28,22,15,9,4,1,2,7,17,31,51,74,100,},
+{128,155,181,204,224,238,248,254,255,253,248,242,236,230,225,223,222,223,225,228,231,234,236,237,237,236,234,231,228,225,223,222,221,222,223,224,226,228,229,229,229,228,226,224,222,220,219,218,217,218,218,220,221,222,223,223,222,222,220,218,217,215,214,213,213,213,213,214,215,216,217,217,217,216,214,213,211,209,208,207,207,207,208,209,210,211,212,212,211,210,209,207,205,204,202,201,201,201,202,203,205,206,207,207,207,206,204,202,199,197,195,193,193,193,195,197,201,204,207,208,209,207,203,196,186,174,160,144,128,112,96,82,70,60,53,49,47,48,49,52,55,59,61,63,63,63,61,59,57,54,52,50,49,49,49,50,51,53,54,55,55,55,54,52,51,49,47,46,45,44,44,45,46,47,48,49,49,49,48,47,45,43,42,40,39,39,39,40,41,42,43,43,43,43,42,41,39,38,36,34,34,33,33,34,35,36,38,38,39,38,37,36,34,32,30,28,27,27,27,28,30,32,33,34,35,34,33,31,28,25,22,20,19,19,20,22,25,28,31,33,34,33,31,26,20,14,8,3,1,2,8,18,32,52,75,101,},
+{128,155,180,203,222,237,247,253,255,253,249,244,238,233,228,226,225,226,228,231,235,238,241,243,243,243,241,239,236,234,231,230,230,230,231,233,235,237,239,240,241,240,239,238,236,234,232,231,231,231,232,234,236,237,239,240,240,240,239,237,236,234,233,232,231,232,233,234,236,237,239,240,240,240,239,237,236,234,232,231,231,231,232,234,236,238,239,240,241,240,239,237,235,233,231,230,230,230,231,234,236,239,241,243,243,243,241,238,235,231,228,226,225,226,228,233,238,244,249,253,255,253,247,237,222,203,180,155,128,101,76,53,34,19,9,3,1,3,7,12,18,23,28,30,31,30,28,25,21,18,15,13,13,13,15,17,20,22,25,26,26,26,25,23,21,19,17,16,15,16,17,18,20,22,24,25,25,25,24,22,20,19,17,16,16,16,17,19,20,22,23,24,25,24,23,22,20,19,17,16,16,16,17,19,20,22,24,25,25,25,24,22,20,18,17,16,15,16,17,19,21,23,25,26,26,26,25,22,20,17,15,13,13,13,15,18,21,25,28,30,31,30,28,23,18,12,7,3,1,3,9,19,34,53,76,101,},
+{128,128,129,129,130,132,134,137,139,141,144,145,146,147,148,148,148,148,149,151,153,156,159,162,165,168,171,172,173,174,174,174,175,177,180,184,191,198,207,217,227,236,244,250,254,255,253,249,242,234,225,216,207,198,192,187,183,181,180,180,180,180,180,179,177,175,173,170,167,165,163,161,160,160,160,160,160,160,160,159,158,156,155,153,151,150,149,148,148,148,148,148,148,148,148,147,146,144,143,142,141,140,139,139,139,139,139,139,139,139,138,137,136,135,134,133,132,132,132,132,132,132,132,132,131,131,130,129,128,127,126,125,125,124,124,124,124,124,124,124,124,123,122,121,120,119,118,117,117,117,117,117,117,117,117,116,115,114,113,112,110,109,108,108,108,108,108,108,108,108,107,106,105,103,101,100,98,97,96,96,96,96,96,96,96,95,93,91,89,86,83,81,79,77,76,76,76,76,76,75,73,69,64,58,49,40,31,22,14,7,3,1,2,6,12,20,29,39,49,58,65,72,76,79,81,82,82,82,83,84,85,88,91,94,97,100,103,105,107,108,108,108,108,109,110,111,112,115,117,119,122,124,126,127,127,128,},
+{128,129,131,133,136,139,142,146,149,153,156,158,160,162,163,164,166,169,174,180,187,197,207,218,228,238,246,252,255,255,252,246,238,229,218,208,199,191,184,180,177,176,176,177,177,178,178,177,175,172,169,166,163,161,159,158,157,157,158,158,159,159,159,158,157,155,153,151,150,148,147,147,147,147,148,149,149,149,149,148,147,145,144,142,141,140,140,140,140,141,141,142,142,142,141,141,139,138,137,136,135,134,134,134,135,135,136,136,136,136,135,135,133,132,131,130,130,129,129,130,130,131,131,131,131,131,130,129,128,127,126,125,125,125,125,125,126,126,127,127,126,126,125,124,123,121,121,120,120,120,120,121,121,122,122,122,121,120,119,118,117,115,115,114,114,114,115,115,116,116,116,116,115,114,112,111,109,108,107,107,107,107,108,109,109,109,109,108,106,105,103,101,99,98,97,97,97,98,98,99,99,98,97,95,93,90,87,84,81,79,78,78,79,79,80,80,79,76,72,65,57,48,38,27,18,10,4,1,1,4,10,18,28,38,49,59,69,76,82,87,90,92,93,94,96,98,100,103,107,110,114,117,120,123,125,127,},
+{128,128,129,132,136,144,154,166,180,195,210,224,236,246,252,255,254,251,244,236,226,215,205,196,188,182,177,174,172,171,171,170,170,170,169,167,166,164,162,159,158,156,155,154,154,153,153,153,153,153,152,151,150,150,149,148,147,146,146,145,145,145,145,145,145,144,144,143,143,142,141,141,140,140,140,140,140,139,139,139,139,139,138,138,137,137,137,136,136,136,136,136,135,135,135,135,135,134,134,134,134,133,133,133,133,132,132,132,132,132,132,131,131,131,131,130,130,130,130,130,129,129,129,129,129,129,128,128,128,128,128,127,127,127,127,127,127,126,126,126,126,126,125,125,125,125,124,124,124,124,124,124,123,123,123,123,122,122,122,122,121,121,121,121,121,120,120,120,120,120,119,119,119,118,118,117,117,117,117,117,116,116,116,116,116,115,115,114,113,113,112,112,111,111,111,111,111,111,110,110,109,108,107,106,106,105,104,103,103,103,103,103,102,102,101,100,98,97,94,92,90,89,87,86,86,86,85,85,84,82,79,74,68,60,51,41,30,20,12,5,2,1,4,10,20,32,46,61,76,90,102,112,120,124,127,128,},
+{128,155,181,204,223,238,249,254,255,252,245,235,225,213,202,192,183,176,170,166,164,163,163,162,162,162,161,160,159,157,155,153,152,150,149,148,148,148,148,147,147,147,147,146,145,145,144,143,142,142,141,141,141,141,141,141,141,140,140,140,139,139,138,138,138,137,137,137,137,137,137,137,136,136,136,136,135,135,135,135,134,134,134,134,134,134,134,134,133,133,133,133,133,132,132,132,132,132,132,132,132,132,131,131,131,131,131,131,130,130,130,130,130,130,130,130,130,129,129,129,129,129,129,129,128,128,128,128,128,128,128,128,128,127,127,127,127,127,127,127,126,126,126,126,126,126,126,126,126,125,125,125,125,125,125,124,124,124,124,124,124,124,124,124,123,123,123,123,123,122,122,122,122,122,122,122,122,121,121,121,121,120,120,120,120,119,119,119,119,119,119,119,118,118,118,117,117,116,116,116,115,115,115,115,115,115,115,114,114,113,112,111,111,110,109,109,109,109,108,108,108,108,107,106,104,103,101,99,97,96,95,94,94,94,93,93,92,90,86,80,73,64,54,43,31,21,11,4,1,2,7,18,33,52,75,101,},
+};
@@ -0,0 +1,34 @@
+/*
+Generated by tools/wavetable_gen.py, SAMPLE_FREQUENCY 32768, 4 notes a row. Don't edit it, change the
+script and run it again.
+
+	This file is part of Sprockit.
+
+    Sprockit is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Sprockit is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Sprockit.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef WAVETABLE_BANKS_H
+#define WAVETABLE_BANKS_H
+
+#define WAVETABLE_BANK_ROWS		32	//Band limited rows in each note bank
+#define WAVETABLE_NOTES_PER_ROW	4	//MIDI notes that share a row
+#define WAVETABLE_HALF_SIZE		129	//Half a cycle plus the last sample, which the mirror can't give back
+#define WAVETABLE_SCAN_FRAMES	16	//Single cycle frames in the scanning bank
+#define WAVETABLE_EXTRA_BYTES	0	//Flash taken by the --extra banks, which nothing plays yet
+
+const unsigned char G_AUC_TRIANGLE_WAVETABLE_LUT [WAVETABLE_BANK_ROWS] [WAVETABLE_HALF_SIZE];
+const unsigned char G_AUC_RAMP_WAVETABLE_LUT [WAVETABLE_BANK_ROWS] [WAVETABLE_HALF_SIZE];
+const unsigned char G_AUC_SCAN_WAVETABLE_LUT [WAVETABLE_SCAN_FRAMES] [256];
+
+#endif /*WAVETABLE_BANKS_H*/
@@ -1,119 +1,40 @@
-/*
-@file wavetables.c
-
-@brief This modules is what it sounds like. A collection of wavetables.
-Big wavetables, like the oscillator ones are stored in program memory.
-Little wavetables, like the LFO ones are stored in RAM.
-
-@ Created by Matt Heins, HackMe Electronics, 2011
-This file is part of Sprockit.
-
-    Sprockit is free software: you can redistribute it and/or modify
-    it under the terms of the GNU General Public License as published by
-    the Free Software Foundation, either version 3 of the License, or
-    (at your option) any later version.
-
-    Sprockit is distributed in the hope that it will be useful,
-    but WITHOUT ANY WARRANTY; without even the implied warranty of
-    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
-    GNU General Public License for more details.
-
-    You should have received a copy of the GNU General Public License
-    along with Sprockit.  If not, see <http://www.gnu.org/licenses/>
-*/
-
-#include <pgmspace.h>
-#include <wavetables.h>
-
-
-//This array contains a calculated sampled sine wave.
-const unsigned char G_AUC_SIN_LUT[256] = { 
-131, 134, 137, 140, 143, 146, 149, 152, 155, 158, 162, 165, 167, 170, 173, 176, 179, 182, 185, 188, 190, 193, 
-196, 198, 201, 203, 206, 208, 211, 213, 215, 218, 220, 222, 224, 226, 228, 230, 232, 234, 235, 237, 238, 240, 
-241, 243, 244, 245, 246, 248, 249, 250, 250, 251, 252, 253, 253, 254, 254, 254, 255, 255, 255, 255, 255, 255, 
-255, 254, 254, 254, 253, 253, 252, 251, 250, 250, 249, 248, 246, 245, 244, 243, 241, 240, 238, 237, 235, 234, 
-232, 230, 228, 226, 224, 222, 220, 218, 215, 213, 211, 208, 206, 203, 201, 198, 196, 193, 190, 188, 185, 182, 
-179, 176, 173, 170, 167, 165, 162, 158, 155, 152, 149, 146, 143, 140, 137, 134, 131, 128, 124, 121, 118, 115, 
-112, 109, 106, 103, 100, 97, 93, 90, 88, 85, 82, 79, 76, 73, 70, 67, 65, 62, 59, 57, 54, 52, 49, 47, 44, 42, 
-40, 37, 35, 33, 31, 29, 27, 25, 23, 21, 20, 18, 17, 15, 14, 12, 11, 10, 9, 7, 6, 5, 5, 4, 3, 2, 2, 1, 1, 1, 0, 
-0, 0, 0, 0, 0, 0, 1, 1, 1, 2, 2, 3, 4, 5, 5, 6, 7, 9, 10, 11, 12, 14, 15, 17, 18, 20, 21, 23, 25, 27, 29, 31, 33, 
-35, 37, 40, 42, 44, 47, 49, 52, 54, 57, 59, 62, 65, 67, 70, 73, 76, 79, 82, 85, 88, 90, 93, 97, 100, 103, 106, 109, 
-112, 115, 118, 121, 124, 127};
-
-const unsigned char G_AUC_TRIANGLE_SIMPLE_WAVETABLE_LUT [256] = {130,132,134,136,138,140,142,144,146,148,150,152,154,156,158,160,162,164,166,168,170,172,174,176,178,180,182,184,186,188,190,192,194,196,198,200,202,204,206,208,210,212,214,216,218,220,222,224,226,228,230,232,234,236,238,240,242,244,246,248,250,252,254,255,254,252,250,248,246,244,242,240,238,236,234,232,230,228,226,224,222,220,218,216,214,212,210,208,206,204,202,200,198,196,194,192,190,188,186,184,182,180,178,176,174,172,170,168,166,164,162,160,158,156,154,152,150,148,146,144,142,140,138,136,134,132,130,128,125,123,121,119,117,115,113,111,109,107,105,103,101,99,97,95,93,91,89,87,85,83,81,79,77,75,73,71,69,67,65,63,61,59,57,55,53,51,49,47,45,43,41,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,0,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,41,43,45,47,49,51,53,55,57,59,61,63,65,67,69,71,73,75,77,79,81,83,85,87,89,91,93,95,97,99,101,103,105,107,109,111,113,115,117,119,121,123,125,128,};
-
-const unsigned char G_AUC_TRIANGLE_WAVETABLE_LUT [32] [256] PROGMEM = { 
-{130,132,134,136,138,140,142,144,146,148,150,152,154,156,158,160,162,164,166,168,170,172,174,176,178,180,182,184,186,188,190,192,194,196,198,200,202,204,206,208,210,212,214,216,218,220,222,224,226,228,230,232,234,236,238,240,242,244,246,248,250,252,254,255,254,252,250,248,246,244,242,240,238,236,234,232,230,228,226,224,222,220,218,216,214,212,210,208,206,204,202,200,198,196,194,192,190,188,186,184,182,180,178,176,174,172,170,168,166,164,162,160,158,156,154,152,150,148,146,144,142,140,138,136,134,132,130,128,125,123,121,119,117,115,113,111,109,107,105,103,101,99,97,95,93,91,89,87,85,83,81,79,77,75,73,71,69,67,65,63,61,59,57,55,53,51,49,47,45,43,41,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,0,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,41,43,45,47,49,51,53,55,57,59,61,63,65,67,69,71,73,75,77,79,81,83,85,87,89,91,93,95,97,99,101,103,105,107,109,111,113,115,117,119,121,123,125,128,},
-{130,132,134,136,138,140,142,144,146,148,150,152,154,156,158,160,162,164,166,168,170,172,174,176,178,180,182,184,186,188,190,192,194,196,198,200,202,204,206,208,210,212,214,216,218,220,222,224,226,228,230,232,234,236,238,240,242,244,246,248,250,252,254,255,254,252,250,248,246,244,242,240,238,236,234,232,230,228,226,224,222,220,218,216,214,212,210,208,206,204,202,200,198,196,194,192,190,188,186,184,182,180,178,176,174,172,170,168,166,164,162,160,158,156,154,152,150,148,146,144,142,140,138,136,134,132,130,128,125,123,121,119,117,115,113,111,109,107,105,103,101,99,97,95,93,91,89,87,85,83,81,79,77,75,73,71,69,67,65,63,61,59,57,55,53,51,49,47,45,43,41,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,0,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,41,43,45,47,49,51,53,55,57,59,61,63,65,67,69,71,73,75,77,79,81,83,85,87,89,91,93,95,97,99,101,103,105,107,109,111,113,115,117,119,121,123,125,128,},
-{130,132,134,136,138,140,142,144,146,148,150,152,154,156,158,160,162,164,166,168,170,172,174,176,178,180,182,184,186,188,190,192,194,196,198,200,202,204,206,208,210,212,214,216,218,220,222,224,226,228,230,232,234,236,238,240,242,244,246,248,250,252,254,255,254,252,250,248,246,244,242,240,238,236,234,232,230,228,226,224,222,220,218,216,214,212,210,208,206,204,202,200,198,196,194,192,190,188,186,184,182,180,178,176,174,172,170,168,166,164,162,160,158,156,154,152,150,148,146,144,142,140,138,136,134,132,130,127,125,123,121,119,117,115,113,111,109,107,105,103,101,99,97,95,93,91,89,87,85,83,81,79,77,75,73,71,69,67,65,63,61,59,57,55,53,51,49,47,45,43,41,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,0,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,41,43,45,47,49,51,53,55,57,59,61,63,65,67,69,71,73,75,77,79,81,83,85,87,89,91,93,95,97,99,101,103,105,107,109,111,113,115,117,119,121,123,125,127,},
-{130,132,134,136,138,140,142,144,146,148,150,152,154,156,158,160,162,164,166,168,170,172,174,176,178,180,182,184,186,188,190,192,194,196,198,200,202,204,206,208,210,212,214,216,218,220,222,224,226,228,230,232,234,236,238,240,242,244,246,248,250,252,254,255,254,252,250,248,246,244,242,240,238,236,234,232,230,228,226,224,222,220,218,216,214,212,210,208,206,204,202,200,198,196,194,192,190,188,186,184,182,180,178,176,174,172,170,168,166,164,162,160,158,156,154,152,150,148,146,144,142,140,138,136,134,132,130,128,125,123,121,119,117,115,113,111,109,107,105,103,101,99,97,95,93,91,89,87,85,83,81,79,77,75,73,71,69,67,65,63,61,59,57,55,53,51,49,47,45,43,41,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,0,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,41,43,45,47,49,51,53,55,57,59,61,63,65,67,69,71,73,75,77,79,81,83,85,87,89,91,93,95,97,99,101,103,105,107,109,111,113,115,117,119,121,123,125,128,},
-{130,132,134,136,138,140,142,144,146,148,150,152,154,156,158,160,162,164,166,168,170,172,174,176,178,180,182,184,186,188,190,192,194,196,198,200,202,204,206,208,210,212,214,216,218,220,222,224,226,228,230,232,234,236,238,240,242,244,246,248,250,252,254,255,254,252,250,248,246,244,242,240,238,236,234,232,230,228,226,224,222,220,218,216,214,212,210,208,206,204,202,200,198,196,194,192,190,188,186,184,182,180,178,176,174,172,170,168,166,164,162,160,158,156,154,152,150,148,146,144,142,140,138,136,134,132,130,128,125,123,121,119,117,115,113,111,109,107,105,103,101,99,97,95,93,91,89,87,85,83,81,79,77,75,73,71,69,67,65,63,61,59,57,55,53,51,49,47,45,43,41,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,0,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,41,43,45,47,49,51,53,55,57,59,61,63,65,67,69,71,73,75,77,79,81,83,85,87,89,91,93,95,97,99,101,103,105,107,109,111,113,115,117,119,121,123,125,128,},
-{130,132,134,136,138,140,142,144,146,148,150,152,154,156,158,160,162,164,166,168,170,172,174,176,178,180,182,184,186,188,190,192,194,196,198,200,202,204,206,208,210,212,214,216,218,220,222,224,226,228,230,232,234,236,238,240,242,244,246,248,250,252,254,255,254,252,250,248,246,244,242,240,238,236,234,232,230,228,226,224,222,220,218,216,214,212,210,208,206,204,202,200,198,196,194,192,190,188,186,184,182,180,178,176,174,172,170,168,166,164,162,160,158,156,154,152,150,148,146,144,142,140,138,136,134,132,130,128,125,123,121,119,117,115,113,111,109,107,105,103,101,99,97,95,93,91,89,87,85,83,81,79,77,75,73,71,69,67,65,63,61,59,57,55,53,51,49,47,45,43,41,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,0,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,41,43,45,47,49,51,53,55,57,59,61,63,65,67,69,71,73,75,77,79,81,83,85,87,89,91,93,95,97,99,101,103,105,107,109,111,113,115,117,119,121,123,125,128,},
-{130,132,134,136,138,140,142,144,146,148,150,152,154,156,158,160,162,164,166,168,170,172,174,176,178,180,182,184,186,188,190,192,194,196,198,200,202,204,206,208,210,212,214,216,218,220,222,224,226,228,230,232,234,236,238,240,242,244,246,248,250,252,254,255,254,252,250,248,246,244,242,240,238,236,234,232,230,228,226,224,222,220,218,216,214,212,210,208,206,204,202,200,198,196,194,192,190,188,186,184,182,180,178,176,174,172,170,168,166,164,162,160,158,156,154,152,150,148,146,144,142,140,138,136,134,132,130,128,125,123,121,119,117,115,113,111,109,107,105,103,101,99,97,95,93,91,89,87,85,83,81,79,77,75,73,71,69,67,65,63,61,59,57,55,53,51,49,47,45,43,41,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,0,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,41,43,45,47,49,51,53,55,57,59,61,63,65,67,69,71,73,75,77,79,81,83,85,87,89,91,93,95,97,99,101,103,105,107,109,111,113,115,117,119,121,123,125,128,},
-{130,132,134,136,138,140,142,144,146,148,150,152,154,156,158,160,162,164,166,168,170,172,174,176,178,180,182,184,186,188,190,192,194,196,198,200,202,204,206,208,210,212,214,216,218,220,222,224,226,228,230,232,234,236,238,240,242,244,246,248,250,252,254,255,254,252,250,248,246,244,242,240,238,236,234,232,230,228,226,224,222,220,218,216,214,212,210,208,206,204,202,200,198,196,194,192,190,188,186,184,182,180,178,176,174,172,170,168,166,164,162,160,158,156,154,152,150,148,146,144,142,140,138,136,134,132,130,128,125,123,121,119,117,115,113,111,109,107,105,103,101,99,97,95,93,91,89,87,85,83,81,79,77,75,73,71,69,67,65,63,61,59,57,55,53,51,49,47,45,43,41,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,0,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,41,43,45,47,49,51,53,55,57,59,61,63,65,67,69,71,73,75,77,79,81,83,85,87,89,91,93,95,97,99,101,103,105,107,109,111,113,115,117,119,121,123,125,128,},
-{130,132,134,136,138,140,142,144,146,148,150,152,154,156,158,160,162,164,166,168,170,172,174,176,178,180,182,184,186,188,190,192,194,196,198,200,202,204,206,208,210,212,214,216,218,220,222,224,226,228,230,232,234,236,238,240,242,244,246,248,250,252,254,255,254,252,250,248,246,244,242,240,238,236,234,232,230,228,226,224,222,220,218,216,214,212,210,208,206,204,202,200,198,196,194,192,190,188,186,184,182,180,178,176,174,172,170,168,166,164,162,160,158,156,154,152,150,148,146,144,142,140,138,136,134,132,130,128,125,123,121,119,117,115,113,111,109,107,105,103,101,99,97,95,93,91,89,87,85,83,81,79,77,75,73,71,69,67,65,63,61,59,57,55,53,51,49,47,45,43,41,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,0,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,41,43,45,47,49,51,53,55,57,59,61,63,65,67,69,71,73,75,77,79,81,83,85,87,89,91,93,95,97,99,101,103,105,107,109,111,113,115,117,119,121,123,125,128,},
-{130,132,134,136,138,140,142,144,146,148,150,152,154,156,158,160,162,164,166,168,170,172,174,176,178,180,182,184,186,188,190,192,194,196,198,200,202,204,206,208,210,212,214,216,218,220,222,224,226,228,230,232,234,236,238,240,242,244,246,248,250,252,254,255,254,252,250,248,246,244,242,240,238,236,234,232,230,228,226,224,222,220,218,216,214,212,210,208,206,204,202,200,198,196,194,192,190,188,186,184,182,180,178,176,174,172,170,168,166,164,162,160,158,156,154,152,150,148,146,144,142,140,138,136,134,132,130,128,125,123,121,119,117,115,113,111,109,107,105,103,101,99,97,95,93,91,89,87,85,83,81,79,77,75,73,71,69,67,65,63,61,59,57,55,53,51,49,47,45,43,41,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,0,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,41,43,45,47,49,51,53,55,57,59,61,63,65,67,69,71,73,75,77,79,81,83,85,87,89,91,93,95,97,99,101,103,105,107,109,111,113,115,117,119,121,123,125,128,},
-{130,132,134,136,138,140,142,144,146,148,150,152,154,156,158,160,162,164,166,168,170,172,174,176,178,180,182,184,186,188,190,192,194,196,198,200,202,204,206,208,210,212,214,216,218,220,222,224,226,228,230,232,234,236,238,240,242,244,246,248,250,252,254,255,254,252,250,248,246,244,242,240,238,236,234,232,230,228,226,224,222,220,218,216,214,212,210,208,206,204,202,200,198,196,194,192,190,188,186,184,182,180,178,176,174,172,170,168,166,164,162,160,158,156,154,152,150,148,146,144,142,140,138,136,134,132,130,128,125,123,121,119,117,115,113,111,109,107,105,103,101,99,97,95,93,91,89,87,85,83,81,79,77,75,73,71,69,67,65,63,61,59,57,55,53,51,49,47,45,43,41,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,0,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,41,43,45,47,49,51,53,55,57,59,61,63,65,67,69,71,73,75,77,79,81,83,85,87,89,91,93,95,97,99,101,103,105,107,109,111,113,115,117,119,121,123,125,128,},
-{130,132,134,136,138,140,142,144,146,148,150,152,154,156,158,160,162,164,166,168,170,172,174,176,178,180,182,184,186,188,190,192,194,196,198,200,202,204,206,208,210,212,214,216,218,220,222,224,226,228,230,232,234,236,238,240,242,244,246,248,250,252,254,255,254,252,250,248,246,244,242,240,238,236,234,232,230,228,226,224,222,220,218,216,214,212,210,208,206,204,202,200,198,196,194,192,190,188,186,184,182,180,178,176,174,172,170,168,166,164,162,160,158,156,154,152,150,148,146,144,142,140,138,136,134,132,130,128,125,123,121,119,117,115,113,111,109,107,105,103,101,99,97,95,93,91,89,87,85,83,81,79,77,75,73,71,69,67,65,63,61,59,57,55,53,51,49,47,45,43,41,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,0,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,41,43,45,47,49,51,53,55,57,59,61,63,65,67,69,71,73,75,77,79,81,83,85,87,89,91,93,95,97,99,101,103,105,107,109,111,113,115,117,119,121,123,125,128,},
-{130,132,134,136,138,140,142,144,146,148,150,152,154,156,158,160,162,164,166,168,170,172,174,176,178,180,182,184,186,188,190,192,194,196,198,200,202,204,206,208,210,212,214,216,218,220,222,224,226,228,230,232,234,236,238,240,242,244,246,248,250,252,254,255,254,252,250,248,246,244,242,240,238,236,234,232,230,228,226,224,222,220,218,216,214,212,210,208,206,204,202,200,198,196,194,192,190,188,186,184,182,180,178,176,174,172,170,168,166,164,162,160,158,156,154,152,150,148,146,144,142,140,138,136,134,132,130,128,125,123,121,119,117,115,113,111,109,107,105,103,101,99,97,95,93,91,89,87,85,83,81,79,77,75,73,71,69,67,65,63,61,59,57,55,53,51,49,47,45,43,41,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,0,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,41,43,45,47,49,51,53,55,57,59,61,63,65,67,69,71,73,75,77,79,81,83,85,87,89,91,93,95,97,99,101,103,105,107,109,111,113,115,117,119,121,123,125,128,},
-{130,132,134,136,138,140,142,144,146,148,150,152,154,156,158,160,162,164,166,168,170,172,174,176,178,180,182,184,186,188,190,192,194,196,198,200,202,204,206,208,210,212,214,216,218,220,222,224,226,228,230,232,234,236,238,240,242,244,246,248,250,252,254,255,254,252,250,248,246,244,242,240,238,236,234,232,230,228,226,224,222,220,218,216,214,212,210,208,206,204,202,200,198,196,194,192,190,188,186,184,182,180,178,176,174,172,170,168,166,164,162,160,158,156,154,152,150,148,146,144,142,140,138,136,134,132,130,128,125,123,121,119,117,115,113,111,109,107,105,103,101,99,97,95,93,91,89,87,85,83,81,79,77,75,73,71,69,67,65,63,61,59,57,55,53,51,49,47,45,43,41,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,0,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,41,43,45,47,49,51,53,55,57,59,61,63,65,67,69,71,73,75,77,79,81,83,85,87,89,91,93,95,97,99,101,103,105,107,109,111,113,115,117,119,121,123,125,128,},
-{130,132,134,136,138,140,142,144,146,148,150,152,154,156,158,160,162,164,166,168,170,172,174,176,178,180,182,184,186,188,190,192,194,196,198,200,202,204,206,208,210,212,214,216,218,220,222,224,226,228,230,232,234,236,238,240,242,244,246,248,250,252,254,255,254,252,250,248,246,244,242,240,238,236,234,232,230,228,226,224,222,220,218,216,214,212,210,208,206,204,202,200,198,196,194,192,190,188,186,184,182,180,178,176,174,172,170,168,166,164,162,160,158,156,154,152,150,148,146,144,142,140,138,136,134,132,130,128,125,123,121,119,117,115,113,111,109,107,105,103,101,99,97,95,93,91,89,87,85,83,81,79,77,75,73,71,69,67,65,63,61,59,57,55,53,51,49,47,45,43,41,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,0,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,41,43,45,47,49,51,53,55,57,59,61,63,65,67,69,71,73,75,77,79,81,83,85,87,89,91,93,95,97,99,101,103,105,107,109,111,113,115,117,119,121,123,125,128,},
-{129,132,134,136,138,140,142,144,146,148,150,152,154,156,158,160,162,164,166,168,170,172,174,176,178,180,182,184,186,188,190,192,194,196,198,200,202,204,206,208,210,212,214,216,218,220,222,224,226,228,230,232,234,236,238,240,242,244,246,248,250,252,254,255,254,252,250,248,246,244,242,240,238,236,234,232,230,228,226,224,222,220,218,216,214,212,210,208,206,204,202,200,198,196,194,192,190,188,186,184,182,180,178,176,174,172,170,168,166,164,162,160,158,156,154,152,150,148,146,144,142,140,138,136,134,132,129,128,126,123,121,119,117,115,113,111,109,107,105,103,101,99,97,95,93,91,89,87,85,83,81,79,77,75,73,71,69,67,65,63,61,59,57,55,53,51,49,47,45,43,41,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,0,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,41,43,45,47,49,51,53,55,57,59,61,63,65,67,69,71,73,75,77,79,81,83,85,87,89,91,93,95,97,99,101,103,105,107,109,111,113,115,117,119,121,123,126,128,},
-{130,132,134,136,138,140,142,144,146,148,150,152,154,156,158,160,162,164,166,168,170,172,174,176,178,180,182,184,186,188,190,192,194,196,198,200,202,204,206,208,210,212,214,216,218,220,222,224,226,228,230,232,234,236,238,240,242,244,246,248,251,253,254,255,254,253,251,248,246,244,242,240,238,236,234,232,230,228,226,224,222,220,218,216,214,212,210,208,206,204,202,200,198,196,194,192,190,188,186,184,182,180,178,176,174,172,170,168,166,164,162,160,158,156,154,152,150,148,146,144,142,140,138,136,134,132,130,128,125,123,121,119,117,115,113,111,109,107,105,103,101,99,97,95,93,91,89,87,85,83,81,79,77,75,73,71,69,67,65,63,61,59,57,55,53,51,49,47,45,43,41,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,4,2,1,0,1,2,4,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,41,43,45,47,49,51,53,55,57,59,61,63,65,67,69,71,73,75,77,79,81,83,85,87,89,91,93,95,97,99,101,103,105,107,109,111,113,115,117,119,121,123,125,128,},
-{130,132,134,136,138,140,142,144,146,148,150,152,154,156,158,160,162,164,166,168,170,172,174,176,178,180,182,184,186,188,190,192,194,196,198,200,202,204,206,208,210,212,214,216,218,220,222,224,226,228,230,232,235,237,239,241,242,244,246,249,251,253,254,255,254,253,251,249,246,244,242,241,239,237,235,232,230,228,226,224,222,220,218,216,214,212,210,208,206,204,202,200,198,196,194,192,190,188,186,184,182,180,178,176,174,172,170,168,166,164,162,160,158,156,154,152,150,148,146,144,142,140,138,136,134,132,130,128,125,123,121,119,117,115,113,111,109,107,105,103,101,99,97,95,93,91,89,87,85,83,81,79,77,75,73,71,69,67,65,63,61,59,57,55,53,51,49,47,45,43,41,39,37,35,33,31,29,27,25,23,20,18,16,14,13,11,9,6,4,2,1,0,1,2,4,6,9,11,13,14,16,18,20,23,25,27,29,31,33,35,37,39,41,43,45,47,49,51,53,55,57,59,61,63,65,67,69,71,73,75,77,79,81,83,85,87,89,91,93,95,97,99,101,103,105,107,109,111,113,115,117,119,121,123,125,128,},
-{130,132,134,136,138,140,142,144,146,148,150,152,154,156,158,160,162,164,166,168,170,172,174,176,178,180,182,184,186,188,190,192,194,196,198,200,202,204,206,209,211,213,215,217,219,221,223,225,227,229,231,233,235,237,239,241,243,245,247,250,252,253,255,255,255,253,252,250,247,245,243,241,239,237,235,233,231,229,227,225,223,221,219,217,215,213,211,209,206,204,202,200,198,196,194,192,190,188,186,184,182,180,178,176,174,172,170,168,166,164,162,160,158,156,154,152,150,148,146,144,142,140,138,136,134,132,130,128,125,123,121,119,117,115,113,111,109,107,105,103,101,99,97,95,93,91,89,87,85,83,81,79,77,75,73,71,69,67,65,63,61,59,57,55,53,51,49,46,44,42,40,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,5,3,2,0,0,0,2,3,5,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,40,42,44,46,49,51,53,55,57,59,61,63,65,67,69,71,73,75,77,79,81,83,85,87,89,91,93,95,97,99,101,103,105,107,109,111,113,115,117,119,121,123,125,128,},
-{129,131,133,136,138,140,142,144,146,148,150,152,154,156,158,160,162,164,166,168,170,172,174,176,178,180,182,184,186,188,191,193,195,197,199,201,203,205,207,209,211,213,215,217,219,221,223,225,227,229,231,233,235,237,239,241,244,246,248,250,252,254,255,255,255,254,252,250,248,246,244,241,239,237,235,233,231,229,227,225,223,221,219,217,215,213,211,209,207,205,203,201,199,197,195,193,191,188,186,184,182,180,178,176,174,172,170,168,166,164,162,160,158,156,154,152,150,148,146,144,142,140,138,136,133,131,129,128,126,124,122,119,117,115,113,111,109,107,105,103,101,99,97,95,93,91,89,87,85,83,81,79,77,75,73,71,69,67,64,62,60,58,56,54,52,50,48,46,44,42,40,38,36,34,32,30,28,26,24,22,20,18,16,14,11,9,7,5,3,1,0,0,0,1,3,5,7,9,11,14,16,18,20,22,24,26,28,30,32,34,36,38,40,42,44,46,48,50,52,54,56,58,60,62,64,67,69,71,73,75,77,79,81,83,85,87,89,91,93,95,97,99,101,103,105,107,109,111,113,115,117,119,122,124,126,128,},
-{129,131,133,135,138,140,142,144,146,148,150,152,154,156,158,160,162,164,166,168,170,172,174,177,179,181,183,185,187,189,191,193,195,197,199,201,203,205,207,209,212,214,216,218,220,222,224,226,227,229,231,233,235,238,240,242,245,247,249,251,253,254,255,255,255,254,253,251,249,247,245,242,240,238,235,233,231,229,227,226,224,222,220,218,216,214,212,209,207,205,203,201,199,197,195,193,191,189,187,185,183,181,179,177,174,172,170,168,166,164,162,160,158,156,154,152,150,148,146,144,142,140,138,135,133,131,129,128,126,124,122,120,117,115,113,111,109,107,105,103,101,99,97,95,93,91,89,87,85,83,81,78,76,74,72,70,68,66,64,62,60,58,56,54,52,50,48,46,43,41,39,37,35,33,31,29,28,26,24,22,20,17,15,13,10,8,6,4,2,1,0,0,0,1,2,4,6,8,10,13,15,17,20,22,24,26,28,29,31,33,35,37,39,41,43,46,48,50,52,54,56,58,60,62,64,66,68,70,72,74,76,78,81,83,85,87,89,91,93,95,97,99,101,103,105,107,109,111,113,115,117,120,122,124,126,128,},
-{130,132,134,136,138,140,142,144,146,148,150,152,154,156,158,160,162,164,167,169,171,173,175,177,179,181,183,185,187,189,191,193,195,197,199,201,204,206,208,210,212,214,216,218,220,222,224,225,227,229,232,234,236,238,241,243,246,248,250,252,253,254,255,255,255,254,253,252,250,248,246,243,241,238,236,234,232,229,227,225,224,222,220,218,216,214,212,210,208,206,204,201,199,197,195,193,191,189,187,185,183,181,179,177,175,173,171,169,167,164,162,160,158,156,154,152,150,148,146,144,142,140,138,136,134,132,130,128,125,123,121,119,117,115,113,111,109,107,105,103,101,99,97,95,93,91,88,86,84,82,80,78,76,74,72,70,68,66,64,62,60,58,56,54,51,49,47,45,43,41,39,37,35,33,31,30,28,26,23,21,19,17,14,12,9,7,5,3,2,1,0,0,0,1,2,3,5,7,9,12,14,17,19,21,23,26,28,30,31,33,35,37,39,41,43,45,47,49,51,54,56,58,60,62,64,66,68,70,72,74,76,78,80,82,84,86,88,91,93,95,97,99,101,103,105,107,109,111,113,115,117,119,121,123,125,128,},
-{130,132,134,136,138,140,143,145,147,149,151,152,154,156,158,160,162,164,166,168,171,173,175,177,179,182,184,186,188,190,193,195,197,199,201,203,204,206,208,210,212,214,216,218,220,222,224,227,229,231,234,236,239,241,243,246,248,250,251,252,254,254,255,255,255,254,254,252,251,250,248,246,243,241,239,236,234,231,229,227,224,222,220,218,216,214,212,210,208,206,204,203,201,199,197,195,193,190,188,186,184,182,179,177,175,173,171,168,166,164,162,160,158,156,154,152,151,149,147,145,143,140,138,136,134,132,130,128,125,123,121,119,117,115,112,110,108,106,104,103,101,99,97,95,93,91,89,87,84,82,80,78,76,73,71,69,67,65,62,60,58,56,54,52,51,49,47,45,43,41,39,37,35,33,31,28,26,24,21,19,16,14,12,9,7,5,4,3,1,1,0,0,0,1,1,3,4,5,7,9,12,14,16,19,21,24,26,28,31,33,35,37,39,41,43,45,47,49,51,52,54,56,58,60,62,65,67,69,71,73,76,78,80,82,84,87,89,91,93,95,97,99,101,103,104,106,108,110,112,115,117,119,121,123,125,127,},
-{129,131,133,135,137,139,141,143,146,148,150,152,154,157,159,161,163,166,168,170,172,175,177,179,181,183,185,187,189,191,193,194,196,198,200,202,204,206,208,210,212,215,217,219,222,224,226,229,231,234,236,239,241,243,245,247,249,250,252,253,254,254,255,255,255,254,254,253,252,250,249,247,245,243,241,239,236,234,231,229,226,224,222,219,217,215,212,210,208,206,204,202,200,198,196,194,193,191,189,187,185,183,181,179,177,175,172,170,168,166,163,161,159,157,154,152,150,148,146,143,141,139,137,135,133,131,129,128,126,124,122,120,118,116,114,112,109,107,105,103,101,98,96,94,92,89,87,85,83,80,78,76,74,72,70,68,66,64,62,61,59,57,55,53,51,49,47,45,43,40,38,36,33,31,29,26,24,21,19,16,14,12,10,8,6,5,3,2,1,1,0,0,0,1,1,2,3,5,6,8,10,12,14,16,19,21,24,26,29,31,33,36,38,40,43,45,47,49,51,53,55,57,59,61,62,64,66,68,70,72,74,76,78,80,83,85,87,89,92,94,96,98,101,103,105,107,109,112,114,116,118,120,122,124,126,127,},
-{130,132,135,137,139,141,144,146,148,150,152,155,157,159,161,163,165,166,168,170,172,174,176,178,180,182,184,186,188,190,192,194,196,198,201,203,205,208,210,213,215,218,220,223,225,228,230,233,235,237,240,242,244,246,247,249,250,251,253,253,254,255,255,255,255,255,254,253,253,251,250,249,247,246,244,242,240,237,235,233,230,228,225,223,220,218,215,213,210,208,205,203,201,198,196,194,192,190,188,186,184,182,180,178,176,174,172,170,168,166,165,163,161,159,157,155,152,150,148,146,144,141,139,137,135,132,130,128,125,123,120,118,116,114,111,109,107,105,103,100,98,96,94,92,90,89,87,85,83,81,79,77,75,73,71,69,67,65,63,61,59,57,54,52,50,47,45,42,40,37,35,32,30,27,25,22,20,18,15,13,11,9,8,6,5,4,2,2,1,0,0,0,0,0,1,2,2,4,5,6,8,9,11,13,15,18,20,22,25,27,30,32,35,37,40,42,45,47,50,52,54,57,59,61,63,65,67,69,71,73,75,77,79,81,83,85,87,89,90,92,94,96,98,100,103,105,107,109,111,114,116,118,120,123,125,127,},
-{130,132,135,137,139,141,144,146,148,150,152,155,157,159,161,163,165,166,168,170,172,174,176,178,180,182,184,186,188,190,192,194,196,198,201,203,205,208,210,213,215,218,220,223,225,228,230,233,235,237,240,242,244,246,247,249,250,251,253,253,254,255,255,255,255,255,254,253,253,251,250,249,247,246,244,242,240,237,235,233,230,228,225,223,220,218,215,213,210,208,205,203,201,198,196,194,192,190,188,186,184,182,180,178,176,174,172,170,168,166,165,163,161,159,157,155,152,150,148,146,144,141,139,137,135,132,130,128,125,123,120,118,116,114,111,109,107,105,103,100,98,96,94,92,90,89,87,85,83,81,79,77,75,73,71,69,67,65,63,61,59,57,54,52,50,47,45,42,40,37,35,32,30,27,25,22,20,18,15,13,11,9,8,6,5,4,2,2,1,0,0,0,0,0,1,2,2,4,5,6,8,9,11,13,15,18,20,22,25,27,30,32,35,37,40,42,45,47,50,52,54,57,59,61,63,65,67,69,71,73,75,77,79,81,83,85,87,89,90,92,94,96,98,100,103,105,107,109,111,114,116,118,120,123,125,127,},
-{129,131,133,135,137,139,141,143,145,147,149,151,153,155,157,160,162,164,167,169,171,174,176,179,181,184,186,189,192,194,197,200,202,205,208,210,213,215,218,220,223,225,228,230,232,234,236,238,240,242,244,245,247,248,250,251,252,253,253,254,254,255,255,255,255,255,254,254,253,253,252,251,250,248,247,245,244,242,240,238,236,234,232,230,228,225,223,220,218,215,213,210,208,205,202,200,197,194,192,189,186,184,181,179,176,174,171,169,167,164,162,160,157,155,153,151,149,147,145,143,141,139,137,135,133,131,129,128,126,124,122,120,118,116,114,112,110,108,106,104,102,100,98,95,93,91,88,86,84,81,79,76,74,71,69,66,63,61,58,55,53,50,47,45,42,40,37,35,32,30,27,25,23,21,19,17,15,13,11,10,8,7,5,4,3,2,2,1,1,0,0,0,0,0,1,1,2,2,3,4,5,7,8,10,11,13,15,17,19,21,23,25,27,30,32,35,37,40,42,45,47,50,53,55,58,61,63,66,69,71,74,76,79,81,84,86,88,91,93,95,98,100,102,104,106,108,110,112,114,116,118,120,122,124,126,127,},
-{129,131,133,135,137,139,141,143,145,147,149,151,153,155,157,160,162,164,167,169,171,174,176,179,181,184,186,189,192,194,197,200,202,205,208,210,213,215,218,220,223,225,228,230,232,234,236,238,240,242,244,245,247,248,250,251,252,253,253,254,254,255,255,255,255,255,254,254,253,253,252,251,250,248,247,245,244,242,240,238,236,234,232,230,228,225,223,220,218,215,213,210,208,205,202,200,197,194,192,189,186,184,181,179,176,174,171,169,167,164,162,160,157,155,153,151,149,147,145,143,141,139,137,135,133,131,129,128,126,124,122,120,118,116,114,112,110,108,106,104,102,100,98,95,93,91,88,86,84,81,79,76,74,71,69,66,63,61,58,55,53,50,47,45,42,40,37,35,32,30,27,25,23,21,19,17,15,13,11,10,8,7,5,4,3,2,2,1,1,0,0,0,0,0,1,1,2,2,3,4,5,7,8,10,11,13,15,17,19,21,23,25,27,30,32,35,37,40,42,45,47,50,53,55,58,61,63,66,69,71,74,76,79,81,84,86,88,91,93,95,98,100,102,104,106,108,110,112,114,116,118,120,122,124,126,127,},
-{131,134,137,140,143,146,149,152,155,158,162,165,167,170,173,176,179,182,185,188,190,193,196,198,201,203,206,208,211,213,215,218,220,222,224,226,228,230,232,234,235,237,238,240,241,243,244,245,246,248,249,250,250,251,252,253,253,254,254,254,255,255,255,255,255,255,255,254,254,254,253,253,252,251,250,250,249,248,246,245,244,243,241,240,238,237,235,234,232,230,228,226,224,222,220,218,215,213,211,208,206,203,201,198,196,193,190,188,185,182,179,176,173,170,167,165,162,158,155,152,149,146,143,140,137,134,131,128,124,121,118,115,112,109,106,103,100,97,93,90,88,85,82,79,76,73,70,67,65,62,59,57,54,52,49,47,44,42,40,37,35,33,31,29,27,25,23,21,20,18,17,15,14,12,11,10,9,7,6,5,5,4,3,2,2,1,1,1,0,0,0,0,0,0,0,1,1,1,2,2,3,4,5,5,6,7,9,10,11,12,14,15,17,18,20,21,23,25,27,29,31,33,35,37,40,42,44,47,49,52,54,57,59,62,65,67,70,73,76,79,82,85,88,90,93,97,100,103,106,109,112,115,118,121,124,127,},
-{131,134,137,140,143,146,149,152,155,158,162,165,167,170,173,176,179,182,185,188,190,193,196,198,201,203,206,208,211,213,215,218,220,222,224,226,228,230,232,234,235,237,238,240,241,243,244,245,246,248,249,250,250,251,252,253,253,254,254,254,255,255,255,255,255,255,255,254,254,254,253,253,252,251,250,250,249,248,246,245,244,243,241,240,238,237,235,234,232,230,228,226,224,222,220,218,215,213,211,208,206,203,201,198,196,193,190,188,185,182,179,176,173,170,167,165,162,158,155,152,149,146,143,140,137,134,131,128,124,121,118,115,112,109,106,103,100,97,93,90,88,85,82,79,76,73,70,67,65,62,59,57,54,52,49,47,44,42,40,37,35,33,31,29,27,25,23,21,20,18,17,15,14,12,11,10,9,7,6,5,5,4,3,2,2,1,1,1,0,0,0,0,0,0,0,1,1,1,2,2,3,4,5,5,6,7,9,10,11,12,14,15,17,18,20,21,23,25,27,29,31,33,35,37,40,42,44,47,49,52,54,57,59,62,65,67,70,73,76,79,82,85,88,90,93,97,100,103,106,109,112,115,118,121,124,127,},
-{131,134,137,140,143,146,149,152,155,158,162,165,167,170,173,176,179,182,185,188,190,193,196,198,201,203,206,208,211,213,215,218,220,222,224,226,228,230,232,234,235,237,238,240,241,243,244,245,246,248,249,250,250,251,252,253,253,254,254,254,255,255,255,255,255,255,255,254,254,254,253,253,252,251,250,250,249,248,246,245,244,243,241,240,238,237,235,234,232,230,228,226,224,222,220,218,215,213,211,208,206,203,201,198,196,193,190,188,185,182,179,176,173,170,167,165,162,158,155,152,149,146,143,140,137,134,131,128,124,121,118,115,112,109,106,103,100,97,93,90,88,85,82,79,76,73,70,67,65,62,59,57,54,52,49,47,44,42,40,37,35,33,31,29,27,25,23,21,20,18,17,15,14,12,11,10,9,7,6,5,5,4,3,2,2,1,1,1,0,0,0,0,0,0,0,1,1,1,2,2,3,4,5,5,6,7,9,10,11,12,14,15,17,18,20,21,23,25,27,29,31,33,35,37,40,42,44,47,49,52,54,57,59,62,65,67,70,73,76,79,82,85,88,90,93,97,100,103,106,109,112,115,118,121,124,127,},
-{131,134,137,140,143,146,149,152,155,158,162,165,167,170,173,176,179,182,185,188,190,193,196,198,201,203,206,208,211,213,215,218,220,222,224,226,228,230,232,234,235,237,238,240,241,243,244,245,246,248,249,250,250,251,252,253,253,254,254,254,255,255,255,255,255,255,255,254,254,254,253,253,252,251,250,250,249,248,246,245,244,243,241,240,238,237,235,234,232,230,228,226,224,222,220,218,215,213,211,208,206,203,201,198,196,193,190,188,185,182,179,176,173,170,167,165,162,158,155,152,149,146,143,140,137,134,131,128,124,121,118,115,112,109,106,103,100,97,93,90,88,85,82,79,76,73,70,67,65,62,59,57,54,52,49,47,44,42,40,37,35,33,31,29,27,25,23,21,20,18,17,15,14,12,11,10,9,7,6,5,5,4,3,2,2,1,1,1,0,0,0,0,0,0,0,1,1,1,2,2,3,4,5,5,6,7,9,10,11,12,14,15,17,18,20,21,23,25,27,29,31,33,35,37,40,42,44,47,49,52,54,57,59,62,65,67,70,73,76,79,82,85,88,90,93,97,100,103,106,109,112,115,118,121,124,127,},
-};
-
-const unsigned char G_AUC_RAMP_SIMPLE_WAVETABLE_LUT [256] = {255,251,250,249,247,247,246,245,244,243,242,241,240,239,238,237,236,235,234,233,232,231,230,229,228,227,226,225,224,223,222,221,220,219,218,217,216,215,214,213,213,211,211,210,209,208,207,206,205,204,203,202,201,200,199,198,197,196,195,194,193,192,191,190,189,188,187,186,185,184,183,182,181,180,179,178,177,176,175,174,173,172,171,170,169,169,168,167,166,165,164,163,162,161,160,159,158,157,156,155,154,153,152,151,150,149,148,147,146,145,144,143,142,141,140,139,138,137,136,135,134,133,132,131,130,129,128,128,127,126,125,124,123,122,121,120,119,118,117,116,115,114,113,112,111,110,109,108,107,106,105,104,103,102,101,100,99,98,97,96,95,94,93,92,91,90,89,88,87,86,86,85,84,83,82,81,80,79,78,77,76,75,74,73,72,71,70,69,68,67,66,65,64,63,62,61,60,59,58,57,56,55,54,53,52,51,50,49,48,47,46,45,44,44,42,42,41,40,39,38,37,36,35,34,33,32,31,30,29,28,27,26,25,24,23,22,21,20,19,18,17,16,15,14,13,12,11,10,9,8,8,6,5,4,0,127,};
-
-const unsigned char G_AUC_RAMP_WAVETABLE_LUT [32] [256] PROGMEM = { 
-{255,251,250,249,247,247,246,245,244,243,242,241,240,239,238,237,236,235,234,233,232,231,230,229,228,227,226,225,224,223,222,221,220,219,218,217,216,215,214,213,213,211,211,210,209,208,207,206,205,204,203,202,201,200,199,198,197,196,195,194,193,192,191,190,189,188,187,186,185,184,183,182,181,180,179,178,177,176,175,174,173,172,171,170,169,169,168,167,166,165,164,163,162,161,160,159,158,157,156,155,154,153,152,151,150,149,148,147,146,145,144,143,142,141,140,139,138,137,136,135,134,133,132,131,130,129,128,128,127,126,125,124,123,122,121,120,119,118,117,116,115,114,113,112,111,110,109,108,107,106,105,104,103,102,101,100,99,98,97,96,95,94,93,92,91,90,89,88,87,86,86,85,84,83,82,81,80,79,78,77,76,75,74,73,72,71,70,69,68,67,66,65,64,63,62,61,60,59,58,57,56,55,54,53,52,51,50,49,48,47,46,45,44,44,42,42,41,40,39,38,37,36,35,34,33,32,31,30,29,28,27,26,25,24,23,22,21,20,19,18,17,16,15,14,13,12,11,10,9,8,8,6,5,4,0,127,},
-{253,255,255,254,253,252,251,250,249,247,246,245,244,243,242,241,240,239,238,237,236,235,234,233,232,231,230,229,228,227,226,225,224,223,222,221,220,219,218,217,216,215,214,213,212,211,210,209,208,207,206,205,204,203,202,201,200,199,198,197,196,195,194,193,191,190,189,188,187,186,185,184,183,182,181,180,179,178,177,176,175,174,173,172,171,170,169,168,167,166,165,164,163,162,161,160,159,158,157,156,155,154,153,152,151,150,149,148,147,146,145,144,143,142,141,140,139,138,137,136,135,134,133,132,131,130,129,127,126,125,124,123,122,121,120,119,118,117,116,115,114,113,112,111,110,109,108,107,106,105,104,103,102,101,100,99,98,97,96,95,94,93,92,91,90,89,88,87,86,85,84,83,82,81,80,79,78,77,76,75,74,73,72,71,70,69,68,67,66,65,64,62,61,60,59,58,57,56,55,54,53,52,51,50,49,48,47,46,45,44,43,42,41,40,39,38,37,36,35,34,33,32,31,30,29,28,27,26,25,24,23,22,21,20,19,18,17,16,15,14,13,12,11,10,9,8,6,5,4,3,2,1,0,0,2,127,},
-{254,255,254,254,253,252,251,250,249,248,247,246,245,244,243,242,241,240,239,238,237,236,235,234,233,232,231,230,229,228,227,225,224,223,222,221,220,219,218,217,216,215,214,213,212,211,210,209,208,207,206,205,204,203,202,201,200,199,198,197,196,195,194,193,192,191,190,189,188,187,186,185,184,183,182,181,180,179,178,177,175,174,173,172,171,170,169,168,167,166,165,164,163,162,161,160,159,158,157,156,155,154,153,152,151,150,149,148,147,146,145,144,143,142,141,140,139,138,137,136,135,134,133,132,131,130,129,127,126,125,124,123,122,121,120,119,118,117,116,115,114,113,112,111,110,109,108,107,106,105,104,103,102,101,100,99,98,97,96,95,94,93,92,91,90,89,88,87,86,85,84,83,82,81,80,78,77,76,75,74,73,72,71,70,69,68,67,66,65,64,63,62,61,60,59,58,57,56,55,54,53,52,51,50,49,48,47,46,45,44,43,42,41,40,39,38,37,36,35,34,33,32,31,30,28,27,26,25,24,23,22,21,20,19,18,17,16,15,14,13,12,11,10,9,8,7,6,5,4,3,2,1,1,0,1,127,},
-{255,252,251,250,249,248,247,246,245,244,243,242,241,240,239,238,237,236,235,234,233,232,231,230,229,228,227,226,225,224,223,222,221,220,219,218,217,216,215,214,213,212,211,210,209,208,207,206,205,204,203,202,201,200,199,198,197,196,196,195,194,193,192,191,190,189,188,187,186,185,184,183,182,181,180,179,178,177,176,175,174,173,172,171,170,169,168,167,166,165,164,163,162,161,160,159,158,157,156,155,154,153,152,151,150,149,148,147,146,145,144,143,142,141,140,139,138,137,136,135,134,133,132,131,130,129,128,127,127,126,125,124,123,122,121,120,119,118,117,116,115,114,113,112,111,110,109,108,107,106,105,104,103,102,101,100,99,98,97,96,95,94,93,92,91,90,89,88,87,86,85,84,83,82,81,80,79,78,77,76,75,74,73,72,71,70,69,68,67,66,65,64,63,62,61,60,59,59,58,57,56,55,54,53,52,51,50,49,48,47,46,45,44,43,42,41,40,39,38,37,36,35,34,33,32,31,30,29,28,27,26,25,24,23,22,21,20,19,18,17,16,15,14,13,12,11,10,9,8,7,6,5,4,3,0,127,},
-{255,244,245,244,242,242,240,241,238,238,237,236,235,234,234,232,232,230,230,229,228,227,226,225,224,223,222,221,220,219,218,217,217,215,215,214,213,212,211,210,209,208,207,206,205,204,203,202,202,200,200,199,198,197,196,195,194,193,192,191,190,189,188,187,187,185,185,184,183,182,181,180,179,178,177,176,175,174,173,172,172,171,170,169,168,167,166,165,164,163,162,161,160,159,158,157,157,156,155,154,153,152,151,150,149,148,147,146,145,144,143,142,142,141,140,139,138,137,136,135,134,133,132,131,130,129,128,127,127,126,125,124,123,122,121,120,119,118,117,116,115,114,113,113,112,111,110,109,108,107,106,105,104,103,102,101,100,99,98,98,97,96,95,94,93,92,91,90,89,88,87,86,85,84,83,83,82,81,80,79,78,77,76,75,74,73,72,71,70,70,68,68,67,66,65,64,63,62,61,60,59,58,57,56,55,55,53,53,52,51,50,49,48,47,46,45,44,43,42,41,40,40,38,38,37,36,35,34,33,32,31,30,29,28,27,26,25,25,23,23,21,21,20,19,18,17,17,14,15,13,13,11,10,11,0,127,},
-{255,251,250,249,248,247,246,245,244,243,242,241,240,239,238,237,236,235,234,233,232,231,230,229,228,227,226,225,224,223,222,221,220,219,218,217,216,215,214,213,212,211,210,209,208,207,206,205,205,204,203,202,201,200,199,198,197,196,195,194,193,192,191,190,189,188,187,186,185,184,183,182,181,180,179,178,177,176,175,174,173,172,171,170,169,168,167,167,166,165,164,163,162,161,160,159,158,157,156,155,154,153,152,151,150,149,148,147,146,145,144,143,142,141,140,139,138,137,136,135,134,133,132,131,130,129,128,128,127,126,125,124,123,122,121,120,119,118,117,116,115,114,113,112,111,110,109,108,107,106,105,104,103,102,101,100,99,98,97,96,95,94,93,92,91,90,89,88,88,87,86,85,84,83,82,81,80,79,78,77,76,75,74,73,72,71,70,69,68,67,66,65,64,63,62,61,60,59,58,57,56,55,54,53,52,51,50,50,49,48,47,46,45,44,43,42,41,40,39,38,37,36,35,34,33,32,31,30,29,28,27,26,25,24,23,22,21,20,19,18,17,16,15,14,13,12,11,10,9,8,7,6,5,4,0,127,},
-{255,248,247,248,246,245,244,243,242,241,240,239,238,237,236,235,234,234,232,231,231,229,229,228,227,226,225,224,223,222,221,220,219,218,217,216,215,214,213,212,211,210,209,208,207,206,205,204,204,203,202,201,200,199,198,197,196,195,194,193,192,191,190,189,188,187,186,185,184,183,182,181,180,180,178,178,177,176,175,174,173,172,171,170,169,168,167,166,165,164,163,162,161,160,159,158,157,156,155,154,153,153,152,151,150,149,148,147,146,145,144,143,142,141,140,139,138,137,136,135,134,133,132,131,130,129,128,128,127,126,125,124,123,122,121,120,119,118,117,116,115,114,113,112,111,110,109,108,107,106,105,104,103,102,102,101,100,99,98,97,96,95,94,93,92,91,90,89,88,87,86,85,84,83,82,81,80,79,78,77,77,75,75,74,73,72,71,70,69,68,67,66,65,64,63,62,61,60,59,58,57,56,55,54,53,52,51,51,50,49,48,47,46,45,44,43,42,41,40,39,38,37,36,35,34,33,32,31,30,29,28,27,26,26,24,24,23,21,21,20,19,18,17,16,15,14,13,12,11,10,9,7,8,7,0,127,},
-{253,255,247,248,250,246,245,246,244,242,242,241,239,239,238,236,236,235,234,233,232,231,230,229,228,227,226,225,224,223,222,221,220,219,218,217,216,215,214,213,213,211,210,210,208,207,207,206,204,204,203,201,201,200,199,198,197,196,195,194,193,192,191,190,189,188,187,186,185,184,183,182,181,180,179,178,177,176,175,174,173,172,172,170,169,169,168,166,166,165,163,163,162,161,160,159,158,157,156,155,154,153,152,151,150,149,148,147,146,145,144,143,142,141,140,139,138,137,136,135,134,133,132,131,130,130,128,127,127,125,125,124,123,122,121,120,119,118,117,116,115,114,113,112,111,110,109,108,107,106,105,104,103,102,101,100,99,98,97,96,95,94,93,92,92,90,89,89,87,86,86,85,83,83,82,81,80,79,78,77,76,75,74,73,72,71,70,69,68,67,66,65,64,63,62,61,60,59,58,57,56,55,54,54,52,51,51,49,48,48,47,45,45,44,42,42,41,40,39,38,37,36,35,34,33,32,31,30,29,28,27,26,25,24,23,22,21,20,19,19,17,16,16,14,13,13,11,9,10,9,5,7,8,0,2,127,},
-{247,254,255,255,254,254,253,252,251,250,249,248,247,246,245,244,243,242,241,240,238,237,236,235,234,233,232,231,230,229,228,227,226,225,224,223,222,221,220,219,218,217,216,215,214,213,212,211,209,208,207,206,205,204,203,202,201,200,199,198,197,196,195,194,193,192,191,190,189,188,187,186,185,184,183,181,180,179,178,177,176,175,174,173,172,171,170,169,168,167,166,165,164,163,162,161,160,159,158,157,156,155,153,152,151,150,149,148,147,146,145,144,143,142,141,140,139,138,137,136,135,134,133,132,131,130,129,127,126,125,124,123,122,121,120,119,118,117,116,115,114,113,112,111,110,109,108,107,106,105,104,103,102,100,99,98,97,96,95,94,93,92,91,90,89,88,87,86,85,84,83,82,81,80,79,78,77,76,75,74,72,71,70,69,68,67,66,65,64,63,62,61,60,59,58,57,56,55,54,53,52,51,50,49,48,47,46,44,43,42,41,40,39,38,37,36,35,34,33,32,31,30,29,28,27,26,25,24,23,22,21,20,19,18,17,15,14,13,12,11,10,9,8,7,6,5,4,3,2,1,1,0,0,1,8,127,},
-{246,255,255,253,252,250,250,249,248,247,246,245,244,243,242,241,240,239,238,237,236,235,234,233,232,231,230,228,227,227,226,225,223,222,221,221,220,218,217,216,215,214,213,212,211,210,209,208,207,206,205,204,203,202,201,200,199,198,197,196,195,194,193,192,191,190,189,188,187,186,185,184,183,182,181,180,179,178,177,176,175,174,173,172,171,170,169,168,167,166,165,164,163,162,161,160,159,158,157,156,155,154,153,152,151,150,149,148,147,146,145,144,143,142,141,140,139,138,137,136,135,134,133,132,131,130,129,127,126,125,124,123,122,121,120,119,118,117,116,115,114,113,112,111,110,109,108,107,106,105,104,103,102,101,100,99,98,97,96,95,94,93,92,91,90,89,88,87,86,85,84,83,82,81,80,79,78,77,76,75,74,73,72,71,70,69,68,67,66,65,64,63,62,61,60,59,58,57,56,55,54,53,52,51,50,49,48,47,46,45,44,43,42,41,40,39,38,37,35,34,34,33,32,30,29,28,28,27,25,24,23,22,21,20,19,18,17,16,15,14,13,12,11,10,9,8,7,6,5,5,3,2,0,0,9,127,},
-{247,255,254,253,252,251,250,249,248,247,246,245,244,243,242,240,239,238,237,236,235,234,233,232,231,230,229,228,227,226,225,224,223,222,221,220,219,218,217,216,215,214,213,212,211,210,209,208,207,206,205,204,203,202,201,200,199,198,197,196,195,194,193,192,191,190,189,188,187,186,185,184,183,182,181,180,179,178,177,176,175,174,173,172,171,170,169,168,167,166,165,164,163,162,161,160,159,158,157,156,155,154,153,152,151,150,149,148,147,146,145,144,143,142,141,140,139,138,137,136,135,134,133,132,131,130,129,127,126,125,124,123,122,121,120,119,118,117,116,115,114,113,112,111,110,109,108,107,106,105,104,103,102,101,100,99,98,97,96,95,94,93,92,91,90,89,88,87,86,85,84,83,82,81,80,79,78,77,76,75,74,73,72,71,70,69,68,67,66,65,64,63,62,61,60,59,58,57,56,55,54,53,52,51,50,49,48,47,46,45,44,43,42,41,40,39,38,37,36,35,34,33,32,31,30,29,28,27,26,25,24,23,22,21,20,19,18,17,16,15,13,12,11,10,9,8,7,6,5,4,3,2,1,0,8,127,},
-{247,255,255,252,252,251,250,249,248,247,246,245,244,243,242,241,240,239,238,237,236,235,234,233,232,231,230,229,228,227,226,225,224,223,221,221,219,219,217,217,215,214,213,212,211,210,209,208,207,206,205,204,203,202,201,200,199,198,197,196,195,194,193,192,191,190,189,188,187,186,185,184,183,182,181,180,179,178,177,176,175,174,173,172,171,170,169,168,167,166,165,164,163,162,161,160,159,158,157,156,155,154,153,152,151,150,149,148,147,146,145,144,143,142,141,140,139,138,137,136,135,134,133,132,131,130,129,127,126,125,124,123,122,121,120,119,118,117,116,115,114,113,112,111,110,109,108,107,106,105,104,103,102,101,100,99,98,97,96,95,94,93,92,91,90,89,88,87,86,85,84,83,82,81,80,79,78,77,76,75,74,73,72,71,70,69,68,67,66,65,64,63,62,61,60,59,58,57,56,55,54,53,52,51,50,49,48,47,46,45,44,43,42,41,40,38,38,36,36,34,34,32,31,30,29,28,27,26,25,24,23,22,21,20,19,18,17,16,15,14,13,12,11,10,9,8,7,6,5,4,3,3,0,0,8,127,},
-{245,255,251,253,248,251,247,247,247,244,245,243,243,241,240,240,238,238,236,235,234,233,233,231,230,229,228,228,226,225,224,223,222,221,220,219,218,217,216,215,214,213,212,211,210,209,208,207,206,205,204,203,202,201,200,199,198,197,196,195,194,193,192,191,190,189,188,187,186,185,184,183,182,181,180,179,178,177,176,175,174,173,172,171,170,169,168,167,166,165,165,163,162,161,160,160,158,157,156,155,155,153,153,151,150,149,148,148,146,145,144,143,143,141,141,139,138,138,136,136,134,134,133,131,131,129,129,127,126,126,124,124,122,121,121,119,119,117,117,116,114,114,112,112,111,110,109,107,107,106,105,104,102,102,100,100,99,98,97,95,95,94,93,92,90,90,89,88,87,86,85,84,83,82,81,80,79,78,77,76,75,74,73,72,71,70,69,68,67,66,65,64,63,62,61,60,59,58,57,56,55,54,53,52,51,50,49,48,47,46,45,44,43,42,41,40,39,38,37,36,35,34,33,32,31,30,29,27,27,26,25,24,22,22,21,20,19,17,17,15,15,14,12,12,10,11,8,8,8,4,7,2,4,0,10,127,},
-{233,255,241,245,247,240,242,243,238,239,240,236,236,236,233,233,233,231,230,230,228,227,227,225,224,225,223,221,222,220,219,219,217,216,216,214,213,213,212,210,210,209,207,207,206,205,204,203,202,201,200,199,198,198,196,196,195,193,193,192,191,190,189,188,187,186,185,184,184,182,181,181,179,178,178,177,175,175,174,173,172,171,170,169,168,167,166,165,164,164,163,161,161,160,158,158,157,156,155,154,153,152,151,150,149,148,147,146,146,144,143,143,142,141,140,139,138,137,136,135,134,133,132,131,130,129,129,127,126,126,125,124,123,122,121,120,119,118,117,116,115,114,113,112,112,111,109,109,108,107,106,105,104,103,102,101,100,99,98,97,97,95,94,94,92,91,91,90,89,88,87,86,85,84,83,82,81,80,80,78,77,77,76,74,74,73,71,71,70,69,68,67,66,65,64,63,62,62,60,59,59,57,57,56,55,54,53,52,51,50,49,48,48,46,45,45,43,42,42,41,39,39,38,36,36,35,33,34,32,30,31,30,28,28,27,25,25,24,22,22,22,19,19,19,15,16,17,12,13,15,8,10,14,0,22,127,},
-{220,255,243,233,240,243,237,233,237,238,233,231,234,233,229,228,230,229,225,225,226,224,222,222,222,220,218,219,219,216,215,215,215,213,211,212,211,209,208,208,207,205,205,205,203,202,201,201,200,198,198,197,196,194,194,194,192,191,191,190,188,187,187,186,184,184,183,182,181,180,180,179,177,177,176,175,173,173,173,171,170,170,169,167,166,166,165,164,163,162,161,160,159,159,158,156,156,155,154,153,152,152,150,149,148,148,147,145,145,144,143,142,141,141,139,138,138,137,135,135,134,133,132,131,131,129,128,128,127,126,124,124,123,122,121,120,120,118,117,117,116,114,114,113,112,111,110,110,108,107,107,106,105,103,103,102,101,100,99,99,97,96,96,95,94,93,92,91,90,89,89,88,86,85,85,84,82,82,82,80,79,78,78,76,75,75,74,73,72,71,71,69,68,68,67,65,64,64,63,61,61,61,59,58,57,57,55,54,54,53,52,50,50,50,48,47,47,46,44,43,44,42,40,40,40,39,36,36,37,35,33,33,33,31,29,30,30,26,25,27,26,22,21,24,22,17,18,22,18,12,15,22,12,0,35,127,},
-{208,252,255,239,231,237,243,241,234,231,234,237,235,230,228,230,232,229,225,224,226,226,224,221,220,222,221,219,217,216,217,217,214,212,212,213,212,209,208,208,208,207,205,203,203,203,202,200,199,199,199,197,195,194,194,194,193,191,190,190,190,188,186,185,185,185,183,182,181,181,180,179,177,177,176,176,174,173,172,172,171,169,168,168,167,166,165,163,163,163,162,160,159,159,158,157,155,154,154,154,152,151,150,150,149,148,146,145,145,144,143,142,141,141,140,138,137,136,136,135,134,132,132,132,131,129,128,127,127,126,124,123,123,123,121,120,119,119,118,117,115,114,114,113,112,111,110,110,109,107,106,105,105,104,103,101,101,101,100,98,97,96,96,95,93,92,92,92,90,89,88,87,87,86,84,83,83,82,81,79,79,78,78,76,75,74,74,73,72,70,70,70,69,67,65,65,65,64,62,61,61,61,60,58,56,56,56,55,53,52,52,52,50,48,47,47,47,46,43,42,43,43,41,38,38,39,38,36,34,33,35,34,31,29,29,31,30,26,23,25,27,25,20,18,21,24,21,14,12,18,24,16,0,3,47,127,},
-{193,238,255,249,235,227,228,235,239,237,231,226,225,229,231,230,226,222,221,223,225,224,221,218,216,217,219,218,216,213,211,212,213,213,211,208,206,206,207,207,206,203,201,201,201,201,200,198,196,196,196,196,195,193,191,190,190,190,190,188,186,185,185,185,184,183,181,180,179,179,179,178,176,174,174,174,174,172,171,169,169,168,168,167,165,164,163,163,163,162,160,159,158,158,157,157,155,153,152,152,152,151,150,148,147,147,147,146,145,143,142,141,141,141,139,138,137,136,136,135,134,133,131,130,130,130,129,127,126,125,125,125,124,122,121,120,119,119,118,117,116,114,114,114,113,112,110,109,108,108,108,107,105,104,103,103,103,102,100,98,98,97,97,96,95,93,92,92,92,91,90,88,87,87,86,86,84,83,81,81,81,81,79,77,76,76,76,75,74,72,71,70,70,70,69,67,65,65,65,65,64,62,60,59,59,59,59,57,55,54,54,54,54,52,49,48,48,49,49,47,44,42,42,43,44,42,39,37,36,38,39,37,34,31,30,32,34,33,29,25,24,26,30,29,24,18,16,20,27,28,20,6,0,17,62,127,},
-{182,225,249,255,247,235,226,224,228,233,237,236,231,226,222,222,224,227,228,226,222,219,217,217,219,220,220,217,214,212,211,211,212,213,212,209,207,205,204,205,206,205,204,202,199,198,198,198,199,198,196,194,192,191,191,192,192,191,189,187,185,185,185,185,184,183,181,179,178,178,178,178,177,176,174,172,171,171,171,171,170,168,166,165,165,165,164,164,163,161,159,158,158,158,158,157,155,154,152,151,151,151,151,149,148,146,145,144,144,144,143,142,141,139,138,138,138,137,136,135,133,132,131,131,131,130,129,127,126,125,124,124,124,123,122,120,119,118,117,117,117,116,114,113,112,111,111,111,110,109,107,106,104,104,104,104,103,101,100,98,97,97,97,97,96,94,92,91,91,90,90,90,89,87,85,84,84,84,84,83,81,79,78,77,77,77,77,76,74,72,71,70,70,70,70,68,66,64,63,63,64,64,63,61,59,57,56,57,57,57,56,53,51,50,49,50,51,50,48,46,43,42,43,44,44,43,41,38,35,35,36,38,38,36,33,29,27,28,31,33,33,29,24,19,18,22,27,31,29,20,8,0,6,30,73,127,},
-{171,209,237,252,255,249,240,230,223,222,224,228,233,235,234,231,226,221,218,218,219,222,223,224,222,219,216,213,211,211,212,213,214,214,212,209,207,204,203,203,204,205,205,204,202,200,198,196,195,195,196,196,196,195,193,191,189,187,187,187,187,187,187,185,183,181,180,179,178,179,179,178,178,176,174,172,171,170,170,170,170,170,168,167,165,163,162,162,162,162,161,161,159,158,156,154,154,153,153,153,153,152,150,149,147,146,145,145,145,144,144,143,141,139,138,137,136,136,136,136,135,134,132,130,129,128,128,127,127,127,126,125,123,121,120,119,119,119,119,118,117,116,114,112,111,111,110,110,110,109,108,106,105,103,102,102,102,102,101,101,99,97,96,94,94,93,93,93,93,92,90,88,87,85,85,85,85,85,84,83,81,79,77,77,76,76,77,76,75,74,72,70,68,68,68,68,68,68,66,64,62,60,59,59,59,60,60,59,57,55,53,51,50,50,51,52,52,51,48,46,43,41,41,42,43,44,44,42,39,36,33,31,32,33,36,37,37,34,29,24,21,20,22,27,31,33,32,25,15,6,0,3,18,46,84,127,},
-{162,194,220,239,251,255,253,247,239,230,224,220,219,221,224,227,230,232,231,229,226,222,218,215,213,213,214,216,217,218,218,217,215,212,209,206,204,204,204,204,205,206,206,205,204,202,199,197,195,194,193,193,194,194,194,194,193,191,189,187,185,184,183,182,183,183,183,183,182,181,179,177,175,173,172,172,172,172,172,172,171,170,169,167,165,163,162,161,161,161,161,161,160,159,158,157,155,153,152,151,150,150,150,150,149,149,148,146,145,143,141,140,139,139,139,139,138,138,137,136,134,133,131,130,128,128,128,128,127,127,127,125,124,122,121,119,118,117,117,116,116,116,116,115,114,112,110,109,107,106,106,105,105,105,105,104,103,102,100,98,97,96,95,94,94,94,94,94,93,92,90,88,86,85,84,83,83,83,83,83,83,82,80,78,76,74,73,72,72,72,72,73,72,71,70,68,66,64,62,61,61,61,61,62,62,61,60,58,56,53,51,50,49,49,50,51,51,51,51,49,46,43,40,38,37,37,38,39,41,42,42,40,37,33,29,26,24,23,25,28,31,34,36,35,31,25,16,8,2,0,4,16,35,61,93,127,},
-{156,182,206,226,240,250,255,255,252,246,239,232,226,221,218,217,218,220,223,225,228,229,229,228,226,222,219,215,212,210,209,208,209,209,211,212,212,213,212,210,208,206,203,201,199,197,196,196,196,197,197,198,198,197,196,195,193,191,188,186,185,183,183,183,183,183,183,183,183,182,181,179,178,176,174,172,171,170,169,169,169,169,169,169,168,168,166,165,163,161,159,158,156,156,155,155,155,155,155,155,154,153,151,150,148,146,145,143,142,142,141,141,141,141,141,140,139,138,137,135,133,131,130,129,128,128,128,128,127,127,127,126,125,124,122,120,118,117,116,115,114,114,114,114,114,113,113,112,110,109,107,105,104,102,101,100,100,100,100,100,100,99,99,97,96,94,92,90,89,87,87,86,86,86,86,86,86,85,84,83,81,79,77,76,74,73,72,72,72,72,72,72,72,72,70,69,67,64,62,60,59,58,57,57,58,58,59,59,59,58,56,54,52,49,47,45,43,42,43,43,44,46,46,47,46,45,43,40,36,33,29,27,26,26,27,30,32,35,37,38,37,34,29,23,16,9,3,0,0,5,15,29,49,73,99,127,},
-{151,173,194,212,227,239,248,253,255,254,251,246,240,234,228,223,219,216,215,214,215,217,219,221,223,225,225,225,224,223,220,217,214,211,208,206,204,203,202,202,203,204,204,205,206,206,205,204,203,201,199,197,194,192,190,189,187,187,187,187,187,187,188,188,188,187,186,185,183,181,179,177,175,174,172,171,170,170,170,170,170,170,170,170,169,168,167,166,164,162,160,158,157,155,154,154,153,153,153,153,153,153,153,152,151,150,148,147,145,143,141,140,138,137,137,136,136,136,136,136,136,135,135,134,132,131,129,128,126,124,123,121,120,120,119,119,119,119,119,119,118,118,117,115,114,112,110,108,107,105,104,103,102,102,102,102,102,102,102,101,101,100,98,97,95,93,91,89,88,87,86,85,85,85,85,85,85,85,85,84,83,81,80,78,76,74,72,70,69,68,67,67,67,68,68,68,68,68,68,66,65,63,61,58,56,54,52,51,50,49,49,50,51,51,52,53,53,52,51,49,47,44,41,38,35,32,31,30,30,30,32,34,36,38,40,41,40,39,36,32,27,21,15,9,4,1,0,2,7,16,28,43,61,82,104,127,},
-{146,164,181,196,211,223,234,242,248,253,255,255,254,251,247,243,238,233,228,223,219,216,213,212,211,211,211,212,214,215,217,218,219,220,220,220,219,218,216,214,211,208,206,203,200,198,196,195,194,193,193,193,193,194,194,195,195,195,195,195,194,193,192,190,188,186,184,182,180,178,176,175,174,173,172,172,172,172,172,172,172,172,172,172,171,170,169,167,166,164,162,160,158,156,155,153,152,151,151,150,150,150,150,150,150,150,150,149,149,148,147,145,144,142,140,138,137,135,133,132,130,129,129,128,128,128,128,128,127,127,127,127,126,126,125,123,122,120,118,117,115,113,111,110,108,107,106,106,105,105,105,105,105,105,105,105,104,104,103,102,100,99,97,95,93,91,89,88,86,85,84,83,83,83,83,83,83,83,83,83,83,82,81,80,79,77,75,73,71,69,67,65,63,62,61,60,60,60,60,60,61,61,62,62,62,62,61,60,59,57,55,52,49,47,44,41,39,37,36,35,35,35,36,37,38,40,41,43,44,44,44,43,42,39,36,32,27,22,17,12,8,4,1,0,0,2,7,13,21,32,44,59,74,91,109,127,},
-{142,157,171,185,198,209,220,229,237,243,248,252,254,255,255,253,251,248,244,240,236,232,227,223,219,216,213,210,209,207,207,206,207,207,208,209,210,211,212,213,214,214,214,214,213,212,211,209,207,205,203,200,198,195,193,191,189,187,186,185,184,183,183,183,183,183,183,184,184,184,184,184,184,183,183,182,180,179,177,176,174,172,170,168,166,164,162,161,159,158,157,157,156,156,156,155,156,156,156,156,156,155,155,154,154,153,152,150,149,147,145,143,142,140,138,136,134,133,132,131,130,129,128,128,128,128,128,128,127,127,127,127,127,126,125,124,123,122,121,119,117,115,113,112,110,108,106,105,103,102,101,101,100,100,99,99,99,99,99,100,99,99,99,98,98,97,96,94,93,91,89,87,85,83,81,79,78,76,75,73,72,72,71,71,71,71,71,71,72,72,72,72,72,72,71,70,69,68,66,64,62,60,57,55,52,50,48,46,44,43,42,41,41,41,41,42,43,44,45,46,47,48,48,49,48,48,46,45,42,39,36,32,28,23,19,15,11,7,4,2,0,0,1,3,7,12,18,26,35,46,57,70,84,98,113,127,},
-{139,151,162,173,183,193,203,211,220,227,233,239,244,248,251,253,254,255,255,254,253,251,248,245,242,239,235,231,227,224,220,217,214,211,208,206,204,202,201,200,199,199,199,199,200,200,201,202,202,203,204,204,205,205,205,205,204,204,203,202,201,199,198,196,194,192,189,187,185,183,180,178,176,174,173,171,170,169,168,167,166,166,165,165,165,165,165,165,165,165,165,165,165,165,165,164,164,163,162,161,159,158,156,155,153,151,149,147,145,143,141,140,138,136,135,133,132,131,130,129,129,128,128,128,128,128,128,128,127,127,127,127,127,127,126,126,125,124,123,122,120,119,117,115,114,112,110,108,106,104,102,100,99,97,96,94,93,92,91,91,90,90,90,90,90,90,90,90,90,90,90,90,90,89,89,88,87,86,85,84,82,81,79,77,75,72,70,68,66,63,61,59,57,56,54,53,52,51,51,50,50,50,50,51,51,52,53,53,54,55,55,56,56,56,56,55,54,53,51,49,47,44,41,38,35,31,28,24,20,16,13,10,7,4,2,1,0,0,1,2,4,7,11,16,22,28,35,44,52,62,72,82,93,104,116,127,},
-{137,147,157,166,176,184,193,201,209,216,223,229,234,239,243,247,250,252,253,255,255,255,254,253,252,250,247,245,242,239,236,232,229,226,222,219,216,213,210,207,204,202,200,198,197,196,195,194,193,193,193,193,193,193,194,194,195,195,196,196,197,197,197,197,197,197,197,196,195,194,193,192,191,189,187,185,183,181,179,177,175,173,171,169,167,165,163,161,159,158,156,155,154,153,152,152,151,151,151,150,150,150,150,150,150,150,150,150,150,150,150,149,149,148,148,147,146,145,143,142,140,139,137,135,133,131,129,127,126,124,122,120,118,116,115,113,112,110,109,108,107,107,106,106,105,105,105,105,105,105,105,105,105,105,105,105,104,104,104,103,103,102,101,100,99,97,96,94,92,90,88,86,84,82,80,78,76,74,72,70,68,66,64,63,62,61,60,59,58,58,58,58,58,58,58,59,59,60,60,61,61,62,62,62,62,62,62,61,60,59,58,57,55,53,51,48,45,42,39,36,33,29,26,23,19,16,13,10,8,5,3,2,1,0,0,0,2,3,5,8,12,16,21,26,32,39,46,54,62,71,79,89,98,108,118,127,},
-{136,144,152,160,168,175,183,190,197,204,210,216,221,226,231,236,239,243,246,249,251,252,254,255,255,255,255,254,253,252,250,248,246,243,241,238,235,232,229,226,223,220,217,214,211,208,205,203,200,198,196,194,192,190,189,188,186,185,185,184,184,183,183,183,183,183,184,184,184,184,185,185,185,186,186,186,186,186,186,185,185,184,184,183,182,181,180,179,177,176,174,172,170,168,167,164,162,160,158,156,154,152,150,148,146,144,142,141,139,137,136,135,134,133,132,131,130,129,129,129,128,128,128,128,128,128,128,128,127,127,127,127,127,127,127,126,126,126,125,124,123,122,121,120,119,118,116,114,113,111,109,107,105,103,101,99,97,95,93,91,88,87,85,83,81,79,78,76,75,74,73,72,71,71,70,70,69,69,69,69,69,69,70,70,70,71,71,71,71,72,72,72,72,72,71,71,70,70,69,67,66,65,63,61,59,57,55,52,50,47,44,41,38,35,32,29,26,23,20,17,14,12,9,7,5,3,2,1,0,0,0,0,1,3,4,6,9,12,16,19,24,29,34,39,45,51,58,65,72,80,87,95,103,111,119,127,},
-{134,140,147,153,160,166,172,178,184,190,195,200,206,211,215,220,224,228,232,235,238,241,244,246,248,250,252,253,254,254,255,255,255,254,254,253,252,251,249,248,246,244,242,239,237,234,232,229,226,224,221,218,215,212,209,207,204,201,198,196,193,191,189,186,184,182,180,179,177,175,174,173,172,171,170,169,168,168,167,167,166,166,166,166,166,166,166,166,166,166,166,166,166,167,167,167,167,167,166,166,166,166,165,165,164,163,163,162,161,160,159,157,156,155,153,151,150,148,146,144,142,140,138,136,134,132,130,128,125,123,121,119,117,115,113,111,109,107,105,104,102,100,99,98,96,95,94,93,92,92,91,90,90,89,89,89,89,88,88,88,88,88,89,89,89,89,89,89,89,89,89,89,89,89,89,88,88,87,87,86,85,84,83,82,81,80,78,76,75,73,71,69,66,64,62,59,57,54,51,48,46,43,40,37,34,31,29,26,23,21,18,16,13,11,9,7,6,4,3,2,1,1,0,0,0,1,1,2,3,5,7,9,11,14,17,20,23,27,31,35,40,44,49,55,60,65,71,77,83,89,95,102,108,115,121,127,},
-{132,137,142,147,151,156,161,165,170,174,179,183,188,192,196,200,204,207,211,215,218,221,224,227,230,233,235,238,240,242,244,246,248,249,250,252,252,253,254,254,255,255,255,255,255,254,254,253,252,251,250,249,247,246,244,243,241,239,237,235,233,230,228,226,223,221,218,216,213,210,208,205,202,200,197,194,191,189,186,183,181,178,176,173,171,168,166,164,162,159,157,155,153,151,150,148,146,145,143,142,140,139,138,137,136,135,134,133,132,132,131,130,130,129,129,129,128,128,128,128,128,128,128,128,128,128,128,128,127,127,127,127,127,127,127,127,127,127,127,126,126,126,125,125,124,123,123,122,121,120,119,118,117,116,115,113,112,110,109,107,105,104,102,100,98,96,93,91,89,87,84,82,79,77,74,72,69,66,64,61,58,55,53,50,47,45,42,39,37,34,32,29,27,25,22,20,18,16,14,12,11,9,8,6,5,4,3,2,1,1,0,0,0,0,0,1,1,2,3,3,5,6,7,9,11,13,15,17,20,22,25,28,31,34,37,40,44,48,51,55,59,63,67,72,76,81,85,90,94,99,104,108,113,118,123,127,},
-{132,137,142,147,151,156,161,165,170,174,179,183,188,192,196,200,204,207,211,215,218,221,224,227,230,233,235,238,240,242,244,246,248,249,250,252,252,253,254,254,255,255,255,255,255,254,254,253,252,251,250,249,247,246,244,243,241,239,237,235,233,230,228,226,223,221,218,216,213,210,208,205,202,200,197,194,191,189,186,183,181,178,176,173,171,168,166,164,162,159,157,155,153,151,150,148,146,145,143,142,140,139,138,137,136,135,134,133,132,132,131,130,130,129,129,129,128,128,128,128,128,128,128,128,128,128,128,128,127,127,127,127,127,127,127,127,127,127,127,126,126,126,125,125,124,123,123,122,121,120,119,118,117,116,115,113,112,110,109,107,105,104,102,100,98,96,93,91,89,87,84,82,79,77,74,72,69,66,64,61,58,55,53,50,47,45,42,39,37,34,32,29,27,25,22,20,18,16,14,12,11,9,8,6,5,4,3,2,1,1,0,0,0,0,0,1,1,2,3,3,5,6,7,9,11,13,15,17,20,22,25,28,31,34,37,40,44,48,51,55,59,63,67,72,76,81,85,90,94,99,104,108,113,118,123,127,},
-{131,134,137,140,143,146,149,152,155,158,162,165,167,170,173,176,179,182,185,188,190,193,196,198,201,203,206,208,211,213,215,218,220,222,224,226,228,230,232,234,235,237,238,240,241,243,244,245,246,248,249,250,250,251,252,253,253,254,254,254,255,255,255,255,255,255,255,254,254,254,253,253,252,251,250,250,249,248,246,245,244,243,241,240,238,237,235,234,232,230,228,226,224,222,220,218,215,213,211,208,206,203,201,198,196,193,190,188,185,182,179,176,173,170,167,165,162,158,155,152,149,146,143,140,137,134,131,128,124,121,118,115,112,109,106,103,100,97,93,90,88,85,82,79,76,73,70,67,65,62,59,57,54,52,49,47,44,42,40,37,35,33,31,29,27,25,23,21,20,18,17,15,14,12,11,10,9,7,6,5,5,4,3,2,2,1,1,1,0,0,0,0,0,0,0,1,1,1,2,2,3,4,5,5,6,7,9,10,11,12,14,15,17,18,20,21,23,25,27,29,31,33,35,37,40,42,44,47,49,52,54,57,59,62,65,67,70,73,76,79,82,85,88,90,93,97,100,103,106,109,112,115,118,121,124,127,},
-{131,134,137,140,143,146,149,152,155,158,162,165,167,170,173,176,179,182,185,188,190,193,196,198,201,203,206,208,211,213,215,218,220,222,224,226,228,230,232,234,235,237,238,240,241,243,244,245,246,248,249,250,250,251,252,253,253,254,254,254,255,255,255,255,255,255,255,254,254,254,253,253,252,251,250,250,249,248,246,245,244,243,241,240,238,237,235,234,232,230,228,226,224,222,220,218,215,213,211,208,206,203,201,198,196,193,190,188,185,182,179,176,173,170,167,165,162,158,155,152,149,146,143,140,137,134,131,128,124,121,118,115,112,109,106,103,100,97,93,90,88,85,82,79,76,73,70,67,65,62,59,57,54,52,49,47,44,42,40,37,35,33,31,29,27,25,23,21,20,18,17,15,14,12,11,10,9,7,6,5,5,4,3,2,2,1,1,1,0,0,0,0,0,0,0,1,1,1,2,2,3,4,5,5,6,7,9,10,11,12,14,15,17,18,20,21,23,25,27,29,31,33,35,37,40,42,44,47,49,52,54,57,59,62,65,67,70,73,76,79,82,85,88,90,93,97,100,103,106,109,112,115,118,121,124,127,},
-};
-
-const unsigned char G_AUC_SQUARE_SIMPLE_WAVETABLE_LUT [256] = {255,252,252,252,251,252,252,252,252,251,252,252,252,252,251,252,252,252,252,251,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,251,252,252,252,252,251,252,252,252,252,251,252,252,252,252,251,252,252,252,255,128,0,3,3,3,4,3,3,3,3,4,3,3,3,3,4,3,3,3,3,4,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,4,3,3,3,3,4,3,3,3,3,4,3,3,3,3,4,3,3,3,0,127,}; 
-
-
+/*
+@file wavetables.c
+
+@brief This modules is what it sounds like. A collection of wavetables.
+They are all stored in program memory, the little ones too, since RAM is only 2K.
+The sine and simple triangle only keep a quarter of a cycle and get folded back out by the accessors in wavetables.h.
+The band limited banks are generated, they are in wavetable_banks.c.
+
+@ Created by Matt Heins, HackMe Electronics, 2011
+This file is part of Sprockit.
+
+    Sprockit is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Sprockit is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Sprockit.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#include <pgmspace.h>
+#include <wavetables.h>
+
+
+//This array contains a quarter of a calculated sampled sine wave, read it with wavetable_sin().
+//Entry 0 is the zero crossing the full wave has at sample 127, entries 1 to 64 are samples 0 to 63.
+const unsigned char G_AUC_SIN_QUARTER_LUT[WAVETABLE_QUARTER_SIZE] PROGMEM = {128,131,134,137,140,143,146,149,152,155,158,162,165,167,170,173,176,179,182,185,188,190,193,196,198,201,203,206,208,211,213,215,218,220,222,224,226,228,230,232,234,235,237,238,240,241,243,244,245,246,248,249,250,250,251,252,253,253,254,254,254,255,255,255,255,};
+
+//A quarter of the simple triangle, laid out the same way. Read it with wavetable_triangle_simple().
+const unsigned char G_AUC_TRIANGLE_SIMPLE_QUARTER_LUT [WAVETABLE_QUARTER_SIZE] PROGMEM = {128,130,132,134,136,138,140,142,144,146,148,150,152,154,156,158,160,162,164,166,168,170,172,174,176,178,180,182,184,186,188,190,192,194,196,198,200,202,204,206,208,210,212,214,216,218,220,222,224,226,228,230,232,234,236,238,240,242,244,246,248,250,252,254,255,};
+
+const unsigned char G_AUC_RAMP_SIMPLE_WAVETABLE_LUT [256] PROGMEM = {255,251,250,249,247,247,246,245,244,243,242,241,240,239,238,237,236,235,234,233,232,231,230,229,228,227,226,225,224,223,222,221,220,219,218,217,216,215,214,213,213,211,211,210,209,208,207,206,205,204,203,202,201,200,199,198,197,196,195,194,193,192,191,190,189,188,187,186,185,184,183,182,181,180,179,178,177,176,175,174,173,172,171,170,169,169,168,167,166,165,164,163,162,161,160,159,158,157,156,155,154,153,152,151,150,149,148,147,146,145,144,143,142,141,140,139,138,137,136,135,134,133,132,131,130,129,128,128,127,126,125,124,123,122,121,120,119,118,117,116,115,114,113,112,111,110,109,108,107,106,105,104,103,102,101,100,99,98,97,96,95,94,93,92,91,90,89,88,87,86,86,85,84,83,82,81,80,79,78,77,76,75,74,73,72,71,70,69,68,67,66,65,64,63,62,61,60,59,58,57,56,55,54,53,52,51,50,49,48,47,46,45,44,44,42,42,41,40,39,38,37,36,35,34,33,32,31,30,29,28,27,26,25,24,23,22,21,20,19,18,17,16,15,14,13,12,11,10,9,8,8,6,5,4,0,127,};
+
+const unsigned char G_AUC_SQUARE_SIMPLE_WAVETABLE_LUT [256] PROGMEM = {255,252,252,252,251,252,252,252,252,251,252,252,252,252,251,252,252,252,252,251,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,251,252,252,252,252,251,252,252,252,252,251,252,252,252,252,251,252,252,252,255,128,0,3,3,3,4,3,3,3,3,4,3,3,3,3,4,3,3,3,3,4,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,4,3,3,3,3,4,3,3,3,3,4,3,3,3,3,4,3,3,3,0,127,};
+
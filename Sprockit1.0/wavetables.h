@@ -1,33 +1,152 @@
-/*
-	This file is part of Sprockit.
-
-    Sprockit is free software: you can redistribute it and/or modify
-    it under the terms of the GNU General Public License as published by
-    the Free Software Foundation, either version 3 of the License, or
-    (at your option) any later version.
-
-    Sprockit is distributed in the hope that it will be useful,
-    but WITHOUT ANY WARRANTY; without even the implied warranty of
-    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
-    GNU General Public License for more details.
-
-    You should have received a copy of the GNU General Public License
-    along with Sprockit.  If not, see <http://www.gnu.org/licenses/>
-*/
-
-#ifndef WAVETABLES_H
-#define WAVETABLES_H
-
-
-const unsigned char G_AUC_SIN_LUT[256]; 
-const unsigned char G_AUC_TRIANGLE_SIMPLE_WAVETABLE_LUT [256];
-const unsigned char G_AUC_TRIANGLE_WAVETABLE_LUT [32] [256];
-const unsigned char G_AUC_RAMP_SIMPLE_WAVETABLE_LUT [256];
-const unsigned char G_AUC_RAMP_WAVETABLE_LUT [32] [256];
-const unsigned char G_AUC_SQUARE_SIMPLE_WAVETABLE_LUT [256];
-
-
-
-
-#endif /*WAVETABLES_H*/
-
+/*
+	This file is part of Sprockit.
+
+    Sprockit is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Sprockit is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Sprockit.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef WAVETABLES_H
+#define WAVETABLES_H
+
+#include <pgmspace.h>
+#include <wavetable_banks.h>
+
+#define WAVETABLE_QUARTER_SIZE	65	//A quarter cycle plus the zero crossing
+
+/*The oscillator picks a bank row with note >> 2 and keeps its neighbour inside rows 0 to 31. Regenerating the banks
+with another layout needs those changed first.*/
+#if WAVETABLE_BANK_ROWS != 32 || WAVETABLE_NOTES_PER_ROW != 4
+#error "The oscillator expects 32 bank rows of 4 notes each."
+#endif
+
+const unsigned char G_AUC_SIN_QUARTER_LUT[WAVETABLE_QUARTER_SIZE]; 
+const unsigned char G_AUC_TRIANGLE_SIMPLE_QUARTER_LUT [WAVETABLE_QUARTER_SIZE];
+const unsigned char G_AUC_RAMP_SIMPLE_WAVETABLE_LUT [256];
+const unsigned char G_AUC_SQUARE_SIMPLE_WAVETABLE_LUT [256];
+
+/*
+@brief This function reads sample uc_index of a 256 sample cycle that is stored as a quarter. The full cycles were
+sampled a sample early, so the first half mirrors about sample 63 with its zero crossing at 127, and the second
+half is the first half upside down. Folding (index + 1) into 0 to 64 finds the quarter entry, and the top bit of
+the index says whether to turn it over.
+
+@param It takes the quarter table in program memory and the sample index.
+
+@return It returns the sample.
+*/
+static inline unsigned char
+wavetable_quarter(const unsigned char *p_uc_quarter, unsigned char uc_index)
+{
+	unsigned char uc_fold,
+				  uc_sample;
+	
+	uc_fold = (uc_index + 1) & 0x7F;
+	
+	if(uc_fold > 64)
+	{
+		uc_fold = 128 - uc_fold;
+	}
+	
+	uc_sample = pgm_read_byte(p_uc_quarter + uc_fold);
+	
+	return (uc_index & 0x80) ? 255 - uc_sample : uc_sample;
+}
+
+/*
+@brief This function reads sample uc_index of a 256 sample cycle that is stored as a half. The ramps and
+triangles mirror about sample 127, sample 254 - n being sample n upside down, so entries 1 to 128 are samples
+0 to 127 and the second half is read back from them turned over. Sample 255 has no partner; entry 0 holds it
+turned over, where the mirror lands for it. Folding (index + 1) finds the entry, negated in the second half.
+
+@param It takes the half row in program memory and the sample index.
+
+@return It returns the sample.
+*/
+static inline unsigned char
+wavetable_half(const unsigned char *p_uc_half, unsigned char uc_index)
+{
+	unsigned char uc_fold;
+	
+	uc_fold = uc_index + 1;
+	
+	if(uc_index & 0x80)
+	{
+		return 255 - pgm_read_byte(p_uc_half + (unsigned char)(-uc_fold));
+	}
+	
+	return pgm_read_byte(p_uc_half + uc_fold);
+}
+
+//The accessors every reader of the tables goes through
+static inline unsigned char
+wavetable_ramp(unsigned char uc_row, unsigned char uc_index)
+{
+	return wavetable_half(G_AUC_RAMP_WAVETABLE_LUT[uc_row], uc_index);
+}
+
+static inline unsigned char
+wavetable_triangle(unsigned char uc_row, unsigned char uc_index)
+{
+	return wavetable_half(G_AUC_TRIANGLE_WAVETABLE_LUT[uc_row], uc_index);
+}
+
+static inline unsigned char
+wavetable_sin(unsigned char uc_index)
+{
+	return wavetable_quarter(G_AUC_SIN_QUARTER_LUT, uc_index);
+}
+
+static inline unsigned char
+wavetable_triangle_simple(unsigned char uc_index)
+{
+	return wavetable_quarter(G_AUC_TRIANGLE_SIMPLE_QUARTER_LUT, uc_index);
+}
+
+static inline unsigned char
+wavetable_ramp_simple(unsigned char uc_index)
+{
+	return pgm_read_byte(&G_AUC_RAMP_SIMPLE_WAVETABLE_LUT[uc_index]);
+}
+
+static inline unsigned char
+wavetable_square_simple(unsigned char uc_index)
+{
+	return pgm_read_byte(&G_AUC_SQUARE_SIMPLE_WAVETABLE_LUT[uc_index]);
+}
+
+/*Flash budget. What the wavetables take out of the ATmega328P's 32768 bytes of program memory. None of them
+take any RAM.
+
+	Table									Bytes
+	G_AUC_RAMP_WAVETABLE_LUT				4128 (half cycles)
+	G_AUC_TRIANGLE_WAVETABLE_LUT			4128 (half cycles)
+	G_AUC_SCAN_WAVETABLE_LUT				4096 (16 frames)
+	Simple ramp and square					512
+	Sine and simple triangle quarters		130
+	Total									12994, leaving 19774 for the code
+
+Every 16 more scan frames is another 4096, and every --extra bank from tools/wavetable_gen.py another 8192. The check below stops the build if the tables would leave less
+than WAVETABLE_FLASH_CODE_RESERVE for the code; it is a floor, so check the real size with avr-size.*/
+#define FLASH_SIZE						32768
+#define WAVETABLE_FLASH_CODE_RESERVE	10240
+#define WAVETABLE_FLASH_BYTES			((2UL * WAVETABLE_BANK_ROWS * WAVETABLE_HALF_SIZE) + (WAVETABLE_SCAN_FRAMES * 256UL) + WAVETABLE_EXTRA_BYTES + (2 * 256) + (2 * WAVETABLE_QUARTER_SIZE))
+
+#if WAVETABLE_FLASH_BYTES > (FLASH_SIZE - WAVETABLE_FLASH_CODE_RESERVE)
+#error "The wavetables leave too little flash for the code. Take some frames out of the scanning bank or drop an extra bank."
+#endif
+
+
+
+
+#endif /*WAVETABLES_H*/
+